@@ -1,8 +1,23 @@
 #pragma once
 
 #include <ChunkedList.hpp>
+#include <ChunkSlab.hpp>
+#include <ChunkedListParallel.hpp>
+#include <ChunkedListSimd.hpp>
+#include <ChunkedSoA.hpp>
+#include <ConcurrentChunkedList.hpp>
+#include <MappedChunkedList.hpp>
+#include <SingleWriterChunkedList.hpp>
 #include <unistd.h>
 #include <random>
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <list>
+#include <numeric>
+#include <thread>
+#include <vector>
 
 #define BEGIN std::cout << "Starting tests..." << std::endl;
 #define SUCCESS std::cout << "All " << testNumber << " tests have been ran.\n" << std::endl; return EXIT_SUCCESS;
@@ -88,14 +103,38 @@ namespace TestUtility {
       }
 
       typename DerivedChunkedList::Chunk *getFront() {
-        return this->front;
+        return this->frontChunk;
       }
 
       typename DerivedChunkedList::Chunk *getBack() {
-        return this->back;
+        return this->backChunk;
       }
   };
 
+  /**
+   * @brief A type without a default constructor, which counts how many of its instances are alive
+   */
+  class LiveCounter {
+    int value;
+
+    public:
+      inline static int liveCount{0};
+
+      explicit LiveCounter(int value);
+
+      LiveCounter(const LiveCounter &other);
+
+      LiveCounter(LiveCounter &&other) noexcept;
+
+      LiveCounter &operator=(const LiveCounter &other) = default;
+
+      LiveCounter &operator=(LiveCounter &&other) noexcept = default;
+
+      ~LiveCounter();
+
+      int getValue() const;
+  };
+
   namespace Tests {
     using DefaultT = int;
     constexpr size_t DefaultChunkSize = 32;
@@ -120,6 +159,69 @@ namespace TestUtility {
 
     template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
     void ConcatenationAndIndexing();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void ChunkRecycling();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void InPlaceConstruction();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void RandomAccess();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void BulkOperations();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void CopyingMovingAndSplicing();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void InsertionAndErasure();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void ParallelAlgorithms();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void SimdKernels();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void SegmentedIteration();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void ConcurrentAppending();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void QueueMode();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void DoubleEndedPushing();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void SnapshotSaving();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void Formatting();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void MemoryStatistics();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void AutomaticChunkSizes();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void StructureOfArrays();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void BulkErasure();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void SlabAllocation();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void Snapshots();
+
+    template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+    void SingleWriterReading();
   }
 }
 
@@ -66,6 +66,26 @@ inline bool TestData::taskIsNull() const {
   return nullTask;
 }
 
+inline LiveCounter::LiveCounter(const int value) : value{value} {
+  ++liveCount;
+}
+
+inline LiveCounter::LiveCounter(const LiveCounter &other) : value{other.value} {
+  ++liveCount;
+}
+
+inline LiveCounter::LiveCounter(LiveCounter &&other) noexcept : value{other.value} {
+  ++liveCount;
+}
+
+inline LiveCounter::~LiveCounter() {
+  --liveCount;
+}
+
+inline int LiveCounter::getValue() const {
+  return value;
+}
+
 inline void TestUtility::callFunction(const char *functionName, void (*functionPtr)()) {
   ++testNumber;
   std::cout << "Test " << testNumber << ": " << functionName << '\n';
@@ -178,6 +198,31 @@ void Tests::Sorting() {
 
     performTask("Iterator operator++(int)");
   }
+
+  performTask("Sorting sorted elements in reverse");
+  list.template sort<std::greater<DefaultT>, SortingAlgorithm>();
+
+  THROW_IF(!std::ranges::is_sorted(list, std::greater<DefaultT>{}), "Reverse sorting failed!")
+
+  if constexpr (SortingAlgorithm == MergeSort) {
+    performTask("Checking stability");
+
+    struct CompareFirst {
+      bool operator()(const std::pair<int, int> &lhs, const std::pair<int, int> &rhs) const {
+        return lhs.first < rhs.first;
+      }
+    };
+
+    ChunkedListType<std::pair<int, int>, 3> pairs;
+
+    for (int i{}; i < 100; ++i) {
+      pairs.push({rng(1, 5), i});
+    }
+
+    pairs.template sort<CompareFirst, SortingAlgorithm>();
+
+    THROW_IF(!std::ranges::is_sorted(pairs), "Sorting was unstable!")
+  }
 }
 
 template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
@@ -346,3 +391,1875 @@ void Tests::EqualityAndInequality() {
   performTask("List equality");
   THROW_IF(list1 == list2, "List comparison 4 failed")
 }
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::ChunkRecycling() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+  using AccessorType = ChunkedListAccessor<DefaultT, ChunkSize>;
+
+  ListType chunkedList{};
+
+  performTask("Pushing");
+  for (int i = 0; i <= ChunkSize; ++i)
+    chunkedList.push(i);
+
+  const auto recycledChunk = reinterpret_cast<AccessorType *>(&chunkedList)->getBack();
+
+  performTask("Popping across a Chunk boundary");
+  chunkedList.pop();
+  chunkedList.pop();
+
+  performTask("Pushing across a Chunk boundary");
+  chunkedList.push(-1);
+  chunkedList.push(-2);
+
+  THROW_IF(reinterpret_cast<AccessorType *>(&chunkedList)->getBack() != recycledChunk,
+           "Popped Chunk was not reused by the next push")
+  THROW_IF(chunkedList.size() != ChunkSize + 1, "Unexpected ChunkedList size after recycling")
+  THROW_IF(chunkedList[ChunkSize] != -2, "Last item is not -2")
+
+  performTask(VARIANT_CODE("Calling setRetentionPolicy()", "Calling set_retention_policy()"));
+  chunkedList.VARIANT_CODE(setRetentionPolicy, set_retention_policy)(KeepHighWaterMark, 2);
+
+  for (int i = 0; i < 4 * ChunkSize; ++i)
+    chunkedList.push(i);
+
+  for (int i = 0; i < 4 * ChunkSize; ++i)
+    chunkedList.pop();
+
+  performTask(VARIANT_CODE("Calling shrinkToFit()", "Calling shrink_to_fit()"));
+  chunkedList.VARIANT_CODE(shrinkToFit, shrink_to_fit)();
+
+  THROW_IF(chunkedList.size() != ChunkSize + 1, "Unexpected ChunkedList size after shrinking")
+
+  for (int i = 0; i < ChunkSize - 1; ++i)
+    THROW_IF(chunkedList[i] != i, "Unexpected item after shrinking")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::InPlaceConstruction() {
+  using ListType = ChunkedListType<LiveCounter, ChunkSize>;
+
+  LiveCounter::liveCount = 0; {
+    ListType chunkedList{};
+
+    THROW_IF(LiveCounter::liveCount != 0, "Creating a ChunkedList constructed elements")
+
+    performTask("Emplacing");
+    for (int i = 0; i < 3 * ChunkSize; ++i) {
+      LiveCounter &counter = chunkedList.emplace(i);
+      THROW_IF(counter.getValue() != i, "emplace() did not return a reference to the new element")
+    }
+
+    THROW_IF(LiveCounter::liveCount != 3 * ChunkSize,
+             std::string{"Unexpected live element count after emplacing; got "} += std::to_string(LiveCounter::liveCount))
+
+    performTask("Popping");
+    for (int i = 0; i < ChunkSize + 1; ++i)
+      chunkedList.pop();
+
+    THROW_IF(LiveCounter::liveCount != 2 * ChunkSize - 1, "Popped elements were not destroyed")
+    THROW_IF(chunkedList[chunkedList.size() - 1].getValue() != 2 * ChunkSize - 2, "Unexpected element after popping")
+
+    performTask("Pushing");
+    chunkedList.push(LiveCounter{-1});
+
+    THROW_IF(LiveCounter::liveCount != 2 * ChunkSize, "Pushing did not leave exactly one new element alive")
+
+    performTask(VARIANT_CODE("Calling popChunk()", "Calling pop_chunk()"));
+    chunkedList.VARIANT_CODE(popChunk, pop_chunk)();
+
+    THROW_IF(LiveCounter::liveCount != static_cast<int>(chunkedList.size()), "Popped Chunk elements were not destroyed")
+  }
+
+  THROW_IF(LiveCounter::liveCount != 0, "Destroying the ChunkedList did not destroy every element")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::RandomAccess() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+  using IteratorType = typename ListType::VARIANT_CODE(Iterator, iterator);
+  using ConstIteratorType = typename ListType::VARIANT_CODE(ConstIterator, const_iterator);
+  using ChunkIteratorType = typename ListType::VARIANT_CODE(ChunkIterator, chunk_iterator);
+
+  static_assert(std::random_access_iterator<IteratorType>, "Iterator is not a random access iterator");
+  static_assert(std::random_access_iterator<ConstIteratorType>, "ConstIterator is not a random access iterator");
+  static_assert(std::random_access_iterator<ChunkIteratorType>, "ChunkIterator is not a random access iterator");
+
+  ListType chunkedList{};
+  const ListType &constListRef = chunkedList;
+
+  performTask("Pushing");
+  for (int i = 0; i < 100; ++i)
+    chunkedList.push(99 - i);
+
+  performTask("Iterator difference");
+  THROW_IF(chunkedList.end() - chunkedList.begin() != 100, "end() - begin() is not equal to the size")
+
+  for (int i = 0; i <= 100; ++i) {
+    auto iterator = chunkedList.begin() + i;
+
+    THROW_IF(iterator - chunkedList.begin() != i, "begin() + i - begin() is not equal to i")
+    THROW_IF(chunkedList.end() - (100 - i) != iterator, "end() - (size - i) is unequal to begin() + i")
+
+    if (i < 100) {
+      THROW_IF(chunkedList.begin()[i] != chunkedList[i], "Iterator indexing is unequal to ChunkedList indexing")
+      THROW_IF(constListRef[i] != 99 - i, "Unexpected value from const indexing")
+      THROW_IF(!(iterator < chunkedList.end()), "begin() + i is not ordered before end()")
+    }
+  }
+
+  performTask("std::sort");
+  std::sort(chunkedList.begin(), chunkedList.end());
+
+  for (int i = 0; i < 100; ++i)
+    THROW_IF(chunkedList[i] != i, "std::sort failed")
+
+  performTask("std::lower_bound");
+  THROW_IF(std::lower_bound(constListRef.begin(), constListRef.end(), 42) - constListRef.begin() != 42,
+           "std::lower_bound returned the wrong position")
+
+  performTask("std::nth_element");
+  std::reverse(chunkedList.begin(), chunkedList.end());
+  std::nth_element(chunkedList.begin(), chunkedList.begin() + 50, chunkedList.end());
+  THROW_IF(chunkedList[50] != 50, "std::nth_element failed")
+
+  performTask("ChunkIterator difference");
+  const auto chunkCount = static_cast<std::ptrdiff_t>((100 + ChunkSize - 1) / ChunkSize);
+  auto beginChunk = chunkedList.VARIANT_CODE(beginChunk, begin_chunk)();
+  auto endChunk = chunkedList.VARIANT_CODE(endChunk, end_chunk)();
+
+  THROW_IF(endChunk - beginChunk != chunkCount, "endChunk() - beginChunk() is not equal to the Chunk count")
+  THROW_IF(beginChunk + chunkCount != endChunk, "beginChunk() + Chunk count is unequal to endChunk()")
+  THROW_IF(std::prev(endChunk) != beginChunk + (chunkCount - 1), "std::prev(endChunk()) is not the back Chunk")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::BulkOperations() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+
+  ListType chunkedList{1, 2, 3};
+
+  std::vector<DefaultT> vector(1000);
+  for (int i = 0; i < 1000; ++i)
+    vector[i] = i;
+
+  performTask("Calling reserve()");
+  chunkedList.reserve(3 + vector.size());
+  THROW_IF(chunkedList.capacity() < 3 + vector.size(), "reserve() did not allocate enough Chunks")
+
+  performTask("Appending a contiguous range");
+  chunkedList.append(vector);
+
+  THROW_IF(chunkedList.size() != 1003, "Unexpected size after appending a vector")
+  for (int i = 0; i < 1000; ++i)
+    THROW_IF(chunkedList[i + 3] != i, "Unexpected item after appending a vector")
+
+  performTask("Appending an iterator pair");
+  const std::list<DefaultT> list{-1, -2, -3};
+  chunkedList.append(list.begin(), list.end());
+
+  THROW_IF(chunkedList.size() != 1006, "Unexpected size after appending a list")
+  THROW_IF(chunkedList[1005] != -3, "Last item is not -3")
+
+  performTask("Shrinking with resize()");
+  chunkedList.resize(2);
+
+  THROW_IF(chunkedList.size() != 2, "Unexpected size after shrinking")
+  THROW_IF(chunkedList[1] != 2, "Last item is not 2 after shrinking")
+
+  performTask("Growing with resize()");
+  chunkedList.resize(2 + 3 * ChunkSize);
+
+  THROW_IF(chunkedList.size() != 2 + 3 * ChunkSize, "Unexpected size after growing")
+  for (size_t i = 2; i < chunkedList.size(); ++i)
+    THROW_IF(chunkedList[i] != 0, "Grown items were not value-initialised")
+
+  chunkedList.resize(4 * ChunkSize + 2, 7);
+  THROW_IF(chunkedList[4 * ChunkSize + 1] != 7, "Grown items were not copies of the given value")
+
+  performTask("Appending non-trivial elements");
+  LiveCounter::liveCount = 0; {
+    ChunkedListType<LiveCounter, ChunkSize> counters{};
+    const std::vector<LiveCounter> source(10, LiveCounter{5});
+
+    counters.append(source);
+    counters.append(source.begin(), source.begin() + 5);
+
+    THROW_IF(counters.size() != 15, "Unexpected size after appending non-trivial elements")
+    THROW_IF(counters[14].getValue() != 5, "Unexpected value after appending non-trivial elements")
+    THROW_IF(LiveCounter::liveCount != 25, "Appended non-trivial elements were not copy constructed")
+
+    counters.resize(1, LiveCounter{0});
+    THROW_IF(LiveCounter::liveCount != 11, "Shrinking did not destroy non-trivial elements")
+  }
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::CopyingMovingAndSplicing() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+
+  static_assert(std::is_nothrow_move_constructible_v<ListType>, "Moving a list may throw");
+  static_assert(std::is_nothrow_move_constructible_v<ChunkedList<int>>, "Moving a ChunkedList<int> may throw");
+
+  ListType chunkedList{};
+  for (int i = 0; i < 10; ++i)
+    chunkedList.push(i);
+
+  performTask("Copy construction");
+  ListType copy{chunkedList};
+
+  THROW_IF(copy != chunkedList, "Copy is unequal to the original")
+
+  copy[0] = -1;
+  THROW_IF(chunkedList[0] != 0, "Modifying the copy modified the original")
+
+  performTask("Copy assignment");
+  copy = chunkedList;
+  THROW_IF(copy != chunkedList, "Copy assigned list is unequal to the original")
+
+  performTask("Move construction");
+  ListType moved{std::move(copy)};
+  THROW_IF(moved != chunkedList, "Moved list is unequal to the original")
+
+  performTask("Reusing a moved-from list");
+  THROW_IF(!copy.empty() || copy.begin() != copy.end(), "Moved-from list is not empty")
+
+  for (int i = 0; i < static_cast<int>(ChunkSize) + 1; ++i)
+    copy.push(i);
+
+  THROW_IF(copy.front() != 0 || copy.back() != static_cast<int>(ChunkSize) || copy[1] != 1,
+           "Pushing to a moved-from list failed")
+
+  ListType insertedInto{std::move(copy)};
+  copy.insert(copy.begin(), 2);
+  copy.insert(copy.begin(), 1);
+  copy.sort();
+  THROW_IF(copy.size() != 2 || copy[0] != 1 || copy[1] != 2, "Inserting into a moved-from list failed")
+
+  ListType erasedFrom{std::move(copy)};
+  THROW_IF(copy.erase(copy.begin(), copy.end()) != copy.end(), "Erasing from a moved-from list failed")
+  copy.pop();
+  THROW_IF(copy.size() != 0 || copy.end() - copy.begin() != 0, "Popping a moved-from list changed its size")
+
+  performTask("Move assignment");
+  copy = std::move(moved);
+  THROW_IF(copy != chunkedList, "Move assigned list is unequal to the original")
+
+  performTask("Storing in a vector");
+  std::vector<ListType> lists{};
+  for (int i = 0; i < 10; ++i)
+    lists.push_back(chunkedList);
+
+  for (const ListType &list: lists)
+    THROW_IF(list != chunkedList, "List stored in a vector is unequal to the original")
+
+  performTask("Growing a vector of lists");
+  std::vector<ListType> grown{};
+  std::vector<const DefaultT *> fronts{};
+  for (int i = 0; i < 33; ++i) {
+    grown.emplace_back(chunkedList);
+    fronts.push_back(&grown.back().front());
+  }
+
+  for (size_t i = 0; i < grown.size(); ++i)
+    THROW_IF(&grown[i].front() != fronts[i], "Growing a vector copied its lists instead of moving them")
+
+  performTask("Swapping");
+  ListType other{100, 200};
+  swap(other, copy);
+
+  THROW_IF(other != chunkedList || copy.size() != 2 || copy[1] != 200, "Swapping failed")
+
+  for (const int size: {0, static_cast<int>(ChunkSize), static_cast<int>(ChunkSize) + 1}) {
+    performTask("Splicing");
+    ListType front{}, back{};
+
+    for (int i = 0; i < size; ++i)
+      front.push(i);
+
+    for (int i = size; i < size + 3 * static_cast<int>(ChunkSize) + 1; ++i)
+      back.push(i);
+
+    front.splice(std::move(back));
+
+    THROW_IF(!back.empty(), "Spliced list is not empty")
+    THROW_IF(front.size() != size + 3 * ChunkSize + 1, "Unexpected size after splicing")
+
+    for (int i = 0; i < static_cast<int>(front.size()); ++i)
+      THROW_IF(front[i] != i, "Unexpected item after splicing")
+
+    THROW_IF(front.end() - front.begin() != static_cast<std::ptrdiff_t>(front.size()),
+             "Iterator distance is unequal to the size after splicing")
+
+    performTask("Reusing a spliced list");
+    back.push(5);
+    front.append(std::move(back));
+    THROW_IF(front[front.size() - 1] != 5, "Last item is not 5 after appending")
+  }
+
+  performTask("Copying non-trivial elements");
+  LiveCounter::liveCount = 0; {
+    ChunkedListType<LiveCounter, ChunkSize> counters{};
+
+    for (int i = 0; i < 10; ++i)
+      counters.emplace(i);
+
+    ChunkedListType<LiveCounter, ChunkSize> counterCopy{counters};
+    THROW_IF(LiveCounter::liveCount != 20, "Copying did not copy construct each element")
+    THROW_IF(counterCopy[9].getValue() != 9, "Unexpected value in the copy")
+  }
+
+  THROW_IF(LiveCounter::liveCount != 0, "Copied elements were not destroyed")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::InsertionAndErasure() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+
+  ListType chunkedList{};
+  std::vector<DefaultT> expected{};
+
+  const auto checkContents = [&chunkedList, &expected] {
+    THROW_IF(chunkedList.size() != expected.size(), "Size is unequal to the expected size")
+    THROW_IF(chunkedList.end() - chunkedList.begin() != static_cast<std::ptrdiff_t>(expected.size()),
+             "Iterator distance is unequal to the size")
+    THROW_IF(!std::ranges::equal(chunkedList, expected), "Iterated elements are unequal to the expected elements")
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+      THROW_IF(chunkedList[i] != expected[i], "Indexed element is unequal to the expected element")
+      THROW_IF(chunkedList.begin()[static_cast<std::ptrdiff_t>(i)] != expected[i],
+               "Element reached by advancing an iterator is unequal to the expected element")
+      THROW_IF(*(chunkedList.end() - static_cast<std::ptrdiff_t>(expected.size() - i)) != expected[i],
+               "Element reached by moving an iterator backwards is unequal to the expected element")
+    }
+
+    const auto beginChunk = chunkedList.VARIANT_CODE(beginChunk, begin_chunk)();
+    const auto endChunk = chunkedList.VARIANT_CODE(endChunk, end_chunk)();
+    std::ptrdiff_t chunkCount = 0;
+
+    for (auto chunk = beginChunk; chunk != endChunk; ++chunk) {
+      THROW_IF(beginChunk + chunkCount != chunk, "Chunk reached by advancing a chunk iterator is not the next Chunk")
+      ++chunkCount;
+    }
+
+    THROW_IF(endChunk - beginChunk != chunkCount, "Chunk iterator distance is unequal to the number of Chunks")
+
+    const auto snapshot = chunkedList.snapshot();
+
+    for (size_t i = 0; i < expected.size(); ++i)
+      THROW_IF(snapshot[i] != expected[i], "Indexed snapshot element is unequal to the expected element")
+  };
+
+  std::mt19937 generator{static_cast<std::mt19937::result_type>(ChunkSize)};
+
+  performTask("Inserting single elements");
+  for (int i = 0; i < 200; ++i) {
+    const auto offset = static_cast<std::ptrdiff_t>(generator() % (expected.size() + 1));
+    const auto iterator = chunkedList.insert(chunkedList.begin() + offset, i);
+
+    THROW_IF(*iterator != i, "Returned iterator does not reference the inserted element")
+    expected.insert(expected.begin() + offset, i);
+  }
+
+  checkContents();
+
+  performTask("Inserting ranges");
+  for (int i = 0; i < 20; ++i) {
+    const auto offset = static_cast<std::ptrdiff_t>(generator() % (expected.size() + 1));
+    const std::vector<DefaultT> range(generator() % (3 * ChunkSize + 2), -i);
+
+    chunkedList.insert(chunkedList.begin() + offset, range.begin(), range.end());
+    expected.insert(expected.begin() + offset, range.begin(), range.end());
+  }
+
+  checkContents();
+
+  performTask("Erasing single elements");
+  for (int i = 0; i < 100; ++i) {
+    const auto offset = static_cast<std::ptrdiff_t>(generator() % expected.size());
+    const auto iterator = chunkedList.erase(chunkedList.begin() + offset);
+
+    expected.erase(expected.begin() + offset);
+    THROW_IF(iterator - chunkedList.begin() != offset, "Returned iterator does not follow the erased element")
+  }
+
+  checkContents();
+
+  performTask("Erasing ranges");
+  while (expected.size() > 10) {
+    const auto offset = static_cast<std::ptrdiff_t>(generator() % expected.size());
+    const auto count = static_cast<std::ptrdiff_t>(generator() % (expected.size() - offset + 1) / 2);
+
+    chunkedList.erase(chunkedList.begin() + offset, chunkedList.begin() + offset + count);
+    expected.erase(expected.begin() + offset, expected.begin() + offset + count);
+  }
+
+  checkContents();
+
+  performTask("Pushing and popping after insertion and erasure");
+  for (int i = 0; i < 10; ++i) {
+    chunkedList.push(i);
+    expected.push_back(i);
+  }
+
+  chunkedList.pop();
+  expected.pop_back();
+
+  checkContents();
+
+  performTask("Pushing and popping at both ends between insertions");
+  for (int i = 0; i < 60; ++i) {
+    const auto offset = static_cast<std::ptrdiff_t>(generator() % (expected.size() + 1));
+    chunkedList.insert(chunkedList.begin() + offset, i);
+    expected.insert(expected.begin() + offset, i);
+
+    if (i % 3 == 0) {
+      chunkedList.VARIANT_CODE(pushFront, push_front)(-i);
+      expected.insert(expected.begin(), -i);
+    }
+
+    if (i % 4 == 0) {
+      chunkedList.VARIANT_CODE(popFront, pop_front)();
+      expected.erase(expected.begin());
+    }
+
+    if (i % 5 == 0) {
+      chunkedList.pop();
+      expected.pop_back();
+    }
+  }
+
+  checkContents();
+
+  performTask("Erasing every element");
+  chunkedList.erase(chunkedList.begin(), chunkedList.end());
+  expected.clear();
+
+  checkContents();
+
+  performTask("Inserting and erasing non-trivial elements");
+  LiveCounter::liveCount = 0; {
+    ChunkedListType<LiveCounter, ChunkSize> counters{};
+
+    for (int i = 0; i < 10; ++i)
+      counters.insert(counters.begin(), LiveCounter{i});
+
+    counters.erase(counters.begin() + 2, counters.begin() + 7);
+    counters.erase(counters.begin());
+
+    THROW_IF(LiveCounter::liveCount != 4, "Erased elements were not destroyed")
+    THROW_IF(counters[0].getValue() != 8 || counters[3].getValue() != 0, "Unexpected element after erasure")
+  }
+
+  THROW_IF(LiveCounter::liveCount != 0, "Inserted elements were not destroyed")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::ParallelAlgorithms() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+  namespace parallel = chunked_list_utility::parallel;
+
+  parallel::thread_pool pool{4};
+
+  ListType chunkedList{};
+  std::vector<DefaultT> expected{};
+
+  RandomNumberGenerator rng;
+
+  for (int i = 0; i < 5000; ++i) {
+    const int value = rng(-1000, 1000);
+    chunkedList.push(value);
+    expected.push_back(value);
+  }
+
+  // leave partially filled Chunks in the middle
+  chunkedList.erase(chunkedList.begin() + 7, chunkedList.begin() + 7 + static_cast<std::ptrdiff_t>(ChunkSize) / 2);
+  expected.erase(expected.begin() + 7, expected.begin() + 7 + static_cast<std::ptrdiff_t>(ChunkSize) / 2);
+
+  performTask("Parallel for_each");
+  parallel::for_each(chunkedList, [](DefaultT &value) { value *= 2; }, pool);
+  std::ranges::for_each(expected, [](DefaultT &value) { value *= 2; });
+
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Parallel for_each did not visit every element once")
+
+  performTask("Parallel transform");
+  parallel::transform(chunkedList, [](const DefaultT value) { return value - 1; }, pool);
+  std::ranges::transform(expected, expected.begin(), [](const DefaultT value) { return value - 1; });
+
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Parallel transform did not transform every element")
+
+  performTask("Parallel reduce");
+  const long long sum = parallel::reduce(chunkedList, 0LL, std::plus<>{}, pool);
+
+  THROW_IF(sum != std::accumulate(expected.begin(), expected.end(), 0LL), "Parallel reduce returned the wrong sum")
+
+  performTask("Parallel count_if");
+  const auto isNegative = [](const DefaultT value) { return value < 0; };
+
+  THROW_IF(parallel::count_if(chunkedList, isNegative, pool) != static_cast<size_t>(std::ranges::count_if(expected, isNegative)),
+           "Parallel count_if returned the wrong count")
+
+  performTask("Parallel sorting");
+  parallel::sort(chunkedList, pool);
+  std::ranges::sort(expected);
+
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Parallel sorting failed!")
+
+  performTask("Parallel sorting with the global pool");
+  parallel::sort<std::greater<> >(chunkedList);
+
+  THROW_IF(!std::ranges::is_sorted(chunkedList, std::greater<>{}), "Parallel sorting with the global pool failed!")
+
+  performTask("Parallel algorithms on an empty list");
+  ListType emptyList{};
+
+  parallel::sort(emptyList, pool);
+  THROW_IF(parallel::reduce(emptyList, 5, std::plus<>{}, pool) != 5, "Parallel reduce of an empty list failed")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::SimdKernels() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+  namespace simd = chunked_list_utility::simd;
+
+  ListType chunkedList{}, otherList{};
+  std::vector<DefaultT> expected{};
+
+  RandomNumberGenerator rng;
+
+  for (int i = 0; i < 5000; ++i) {
+    const int value = rng(-100, 100);
+    chunkedList.push(value);
+    otherList.push(value);
+    expected.push_back(value);
+  }
+
+  // leave partially filled Chunks in the middle, so that the lists' Chunks are filled differently
+  chunkedList.erase(chunkedList.begin() + 7, chunkedList.begin() + 7 + static_cast<std::ptrdiff_t>(ChunkSize) / 2);
+  expected.erase(expected.begin() + 7, expected.begin() + 7 + static_cast<std::ptrdiff_t>(ChunkSize) / 2);
+
+  const DefaultT needle = expected[expected.size() / 2];
+  const auto [expectedMin, expectedMax] = std::ranges::minmax(expected);
+  const long long expectedSum = std::accumulate(expected.begin(), expected.end(), 0LL);
+  const long long expectedDot = std::inner_product(expected.begin(), expected.end(), otherList.begin(), 0LL);
+
+  const simd::InstructionSet supported = simd::supported_instruction_set();
+
+  for (const simd::InstructionSet instructionSet: {simd::Scalar, simd::SSE2, simd::AVX2}) {
+    if (instructionSet > supported) break;
+
+    simd::set_instruction_set(instructionSet);
+
+    performTask("SIMD find");
+    const auto it = simd::find(chunkedList, needle);
+
+    THROW_IF(it == chunkedList.end() || *it != needle, "SIMD find did not find the element")
+    THROW_IF(it - chunkedList.begin() != std::ranges::find(expected, needle) - expected.begin(),
+             "SIMD find did not find the first equal element")
+    THROW_IF(simd::contains(chunkedList, 1000), "SIMD contains found a missing element")
+
+    performTask("SIMD count");
+    THROW_IF(simd::count(chunkedList, needle) != static_cast<size_t>(std::ranges::count(expected, needle)),
+             "SIMD count returned the wrong count")
+
+    performTask("SIMD min and max");
+    THROW_IF(simd::min(chunkedList) != expectedMin || simd::max(chunkedList) != expectedMax,
+             "SIMD min and max returned the wrong elements")
+
+    performTask("SIMD sum and dot");
+    THROW_IF(simd::sum(chunkedList) != expectedSum, "SIMD sum returned the wrong sum")
+    THROW_IF(simd::dot(chunkedList, otherList) != expectedDot, "SIMD dot returned the wrong product")
+  }
+
+  simd::set_instruction_set(supported);
+
+  performTask("SIMD kernels on an empty list");
+  const ListType emptyList{};
+
+  THROW_IF(simd::find(emptyList, 0) != emptyList.end() || simd::count(emptyList, 0) != 0 || simd::sum(emptyList) != 0,
+           "SIMD kernels on an empty list failed")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::SegmentedIteration() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+  namespace segmented = chunked_list_utility::segmented;
+
+  static_assert(std::ranges::random_access_range<ListType> && std::ranges::sized_range<ListType>);
+  static_assert(std::ranges::random_access_range<const ListType> && std::ranges::common_range<const ListType>);
+  static_assert(segmented::chunked_range<ListType> && segmented::chunked_range<const ListType>);
+
+  ListType chunkedList{};
+  std::vector<DefaultT> expected{};
+
+  for (int i = 0; i < 200; ++i) {
+    chunkedList.push(i);
+    expected.push_back(i);
+  }
+
+  // leave a partially filled Chunk in the middle, so that not only the back Chunk is partial
+  chunkedList.erase(chunkedList.begin() + 3);
+  expected.erase(expected.begin() + 3);
+
+  performTask("Iterating over Chunk spans");
+  size_t elementCount = 0;
+  std::vector<DefaultT> visited{};
+
+  for (const std::span<DefaultT> chunk: chunkedList.chunks()) {
+    THROW_IF(chunk.size() > ChunkSize, "A Chunk span is larger than the ChunkSize")
+
+    elementCount += chunk.size();
+    visited.insert(visited.end(), chunk.begin(), chunk.end());
+  }
+
+  THROW_IF(elementCount != chunkedList.size(), "Chunk spans do not cover every element")
+  THROW_IF(visited != expected, "Chunk spans did not visit the elements in order")
+
+  const auto &constList = chunkedList;
+  THROW_IF(std::ranges::size(constList.chunks()) != std::ranges::size(chunkedList.chunks()),
+           "Const and non-const Chunk views are different sizes")
+  THROW_IF(constList.chunks()[0].size() != (ChunkSize > 3 ? ChunkSize - 1 : ChunkSize),
+           "The first Chunk span is the wrong size")
+
+  performTask("Segmented for_each");
+  segmented::for_each(chunkedList, [](DefaultT &value) { value *= 3; });
+  std::ranges::for_each(expected, [](DefaultT &value) { value *= 3; });
+
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Segmented for_each did not visit every element once")
+
+  long long sum = 0;
+  segmented::for_each(constList, [&sum](const DefaultT value) { sum += value; });
+
+  THROW_IF(sum != std::accumulate(expected.begin(), expected.end(), 0LL), "Const segmented for_each failed")
+
+  performTask("Segmented copy");
+  std::vector<DefaultT> copied(chunkedList.size());
+
+  THROW_IF(segmented::copy(chunkedList, copied.begin()) != copied.end(), "Segmented copy returned the wrong iterator")
+  THROW_IF(copied != expected, "Segmented copy did not copy every element in order")
+
+  performTask("Segmented fill");
+  segmented::fill(chunkedList, 7);
+
+  THROW_IF(!std::ranges::all_of(chunkedList, [](const DefaultT value) { return value == 7; }),
+           "Segmented fill did not assign every element")
+
+  performTask("Standard range algorithms");
+  std::iota(expected.begin(), expected.end(), 0);
+  std::ranges::copy(expected, chunkedList.begin());
+
+  THROW_IF(std::ranges::lower_bound(chunkedList, 150) - chunkedList.begin() != 150,
+           "Binary search through the random access range failed")
+  THROW_IF(!std::ranges::equal(chunkedList | std::views::reverse | std::views::take(3), std::vector<DefaultT>{198, 197, 196}),
+           "Reverse view over the ChunkedList failed")
+
+  performTask("Segmented algorithms on an empty list");
+  ListType emptyList{};
+
+  THROW_IF(segmented::copy(emptyList, copied.begin()) != copied.begin(), "Segmented copy of an empty list failed")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::ConcurrentAppending() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+
+  static_assert(std::ranges::forward_range<ConcurrentChunkedList<DefaultT, ChunkSize> >);
+
+  constexpr int producerCount = 4;
+  constexpr int pushesPerProducer = 2000;
+
+  ConcurrentChunkedList<DefaultT, ChunkSize> concurrentList{};
+
+  performTask("Pushing from several threads while reading");
+  std::atomic<bool> producing{true};
+  std::atomic<bool> readerFailed{false};
+
+  std::thread reader{
+    [&] {
+      while (producing.load()) {
+        size_t readCount = 0;
+
+        for (const DefaultT value: concurrentList) {
+          if (value < 0 || value >= producerCount * pushesPerProducer)
+            readerFailed = true;
+
+          ++readCount;
+        }
+
+        if (readCount > producerCount * pushesPerProducer)
+          readerFailed = true;
+      }
+    }
+  };
+
+  std::vector<std::thread> producers{};
+
+  for (int producer = 0; producer < producerCount; ++producer) {
+    producers.emplace_back([&concurrentList, producer] {
+      for (int i = 0; i < pushesPerProducer; ++i)
+        concurrentList.push(producer * pushesPerProducer + i);
+    });
+  }
+
+  for (std::thread &producer: producers)
+    producer.join();
+
+  producing = false;
+  reader.join();
+
+  THROW_IF(readerFailed, "A reader observed an element which was not pushed")
+  THROW_IF(concurrentList.size() != producerCount * pushesPerProducer, "Concurrent pushes were lost")
+
+  performTask("Copying the pushed elements");
+  ListType chunkedList{};
+  chunkedList.append(concurrentList);
+
+  THROW_IF(chunkedList.size() != concurrentList.size(), "Iteration did not reach every published element")
+
+  chunkedList.sort();
+
+  std::vector<DefaultT> expected(producerCount * pushesPerProducer);
+  std::iota(expected.begin(), expected.end(), 0);
+
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Concurrent pushes were duplicated or corrupted")
+
+  performTask("Pushes from each thread keep their order");
+  std::vector<DefaultT> lastPushed(producerCount, -1);
+
+  for (const DefaultT value: concurrentList) {
+    THROW_IF(value <= lastPushed[value / pushesPerProducer], "A thread's pushes were reordered")
+    lastPushed[value / pushesPerProducer] = value;
+  }
+
+  performTask("Iterating over an empty ConcurrentChunkedList");
+  const ConcurrentChunkedList<DefaultT, ChunkSize> emptyList{};
+
+  THROW_IF(emptyList.begin() != emptyList.end() || !emptyList.empty(), "Empty ConcurrentChunkedList is not empty")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::QueueMode() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+  using AccessorType = ChunkedListAccessor<DefaultT, ChunkSize>;
+
+  ListType chunkedList{};
+  std::deque<DefaultT> expected{};
+
+  performTask(VARIANT_CODE("Interleaving push() and popFront()", "Interleaving push() and pop_front()"));
+  int nextValue = 0;
+  size_t maxChunkCount = 0;
+
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 3 * ChunkSize / 2 + 1; ++i) {
+      chunkedList.push(nextValue);
+      expected.push_back(nextValue++);
+    }
+
+    for (int i = 0; i < 3 * ChunkSize / 2; ++i) {
+      THROW_IF(chunkedList.front() != expected.front(), "Unexpected front element")
+      chunkedList.VARIANT_CODE(popFront, pop_front)();
+      expected.pop_front();
+    }
+
+    THROW_IF(chunkedList.size() != expected.size(), "Unexpected size after popping from the front")
+    THROW_IF(chunkedList.back() != expected.back(), "Unexpected back element")
+
+    maxChunkCount = std::max(maxChunkCount, reinterpret_cast<AccessorType *>(&chunkedList)->getChunkCount());
+  }
+
+  // the queue holds at most 50 elements, so consumed Chunks must have been released
+  THROW_IF(maxChunkCount > 50 / ChunkSize + 3, "Consumed Chunks were not released")
+
+  performTask("Reading after popping from the front");
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Iteration does not match the popped queue")
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    THROW_IF(chunkedList[i] != expected[i], "Indexing does not match the popped queue")
+
+  THROW_IF(chunkedList.end() - chunkedList.begin() != static_cast<std::ptrdiff_t>(expected.size()),
+           "Iterator distance does not match the size")
+  THROW_IF(*(chunkedList.begin() + 7) != expected[7], "Iterator arithmetic does not skip the popped elements")
+
+  performTask("Sorting after popping from the front");
+  chunkedList.push(-1);
+  expected.push_back(-1);
+  chunkedList.sort();
+  std::ranges::sort(expected);
+
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Sorting after popping from the front failed")
+
+  performTask("Inserting into and erasing from a popped front Chunk");
+  chunkedList.VARIANT_CODE(popFront, pop_front)(2);
+  expected.erase(expected.begin(), expected.begin() + 2);
+
+  chunkedList.insert(chunkedList.begin() + 1, -5);
+  expected.insert(expected.begin() + 1, -5);
+  chunkedList.erase(chunkedList.begin());
+  expected.erase(expected.begin());
+
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Insertion or erasure after popping from the front failed")
+
+  performTask("Popping more elements than are held");
+  chunkedList.VARIANT_CODE(popFront, pop_front)(expected.size() + 10);
+
+  THROW_IF(!chunkedList.empty() || chunkedList.begin() != chunkedList.end(), "ChunkedList is not empty")
+
+  chunkedList.push(1);
+  THROW_IF(chunkedList.front() != 1 || chunkedList.back() != 1, "Pushing after emptying the queue failed")
+
+  performTask("Destroying popped elements");
+  {
+    ChunkedListType<LiveCounter, ChunkSize> counters{};
+
+    for (int i = 0; i < 3 * ChunkSize; ++i)
+      counters.emplace(i);
+
+    counters.VARIANT_CODE(popFront, pop_front)(ChunkSize + 1);
+
+    THROW_IF(LiveCounter::liveCount != 2 * ChunkSize - 1, "Popped elements were not destroyed")
+    THROW_IF(counters.front().getValue() != ChunkSize + 1, "Unexpected front element after popping")
+
+    ChunkedListType<LiveCounter, ChunkSize> copy{counters};
+
+    THROW_IF(copy.size() != counters.size() || copy[0].getValue() != ChunkSize + 1, "Copying a popped queue failed")
+  }
+
+  THROW_IF(LiveCounter::liveCount != 0, "Elements were leaked")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::DoubleEndedPushing() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+  using AccessorType = ChunkedListAccessor<DefaultT, ChunkSize>;
+
+  ListType chunkedList{};
+  std::deque<DefaultT> expected{};
+
+  performTask(VARIANT_CODE("Calling pushFront()", "Calling push_front()"));
+  for (int i = 0; i < 5 * ChunkSize + 1; ++i) {
+    chunkedList.VARIANT_CODE(pushFront, push_front)(i);
+    expected.push_front(i);
+  }
+
+  THROW_IF(chunkedList.size() != expected.size(), "Unexpected size after pushing to the front")
+  THROW_IF(chunkedList.front() != 5 * ChunkSize || chunkedList.back() != 0, "Unexpected front or back element")
+  THROW_IF(reinterpret_cast<AccessorType *>(&chunkedList)->getChunkCount() != 6,
+           "Pushing to the front did not fill whole Chunks")
+
+  performTask("Pushing to both ends");
+  for (int i = 0; i < 3 * ChunkSize; ++i) {
+    if (i % 3 == 0) {
+      chunkedList.push(-i);
+      expected.push_back(-i);
+    } else {
+      chunkedList.VARIANT_CODE(emplaceFront, emplace_front)(-i);
+      expected.push_front(-i);
+    }
+  }
+
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Iteration does not match the pushed elements")
+
+  performTask("Random access after pushing to the front");
+  for (size_t i = 0; i < expected.size(); ++i)
+    THROW_IF(chunkedList[i] != expected[i], "Indexing does not match the pushed elements")
+
+  for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(expected.size()); i += 3) {
+    THROW_IF(*(chunkedList.begin() + i) != expected[i], "Iterator arithmetic does not match the pushed elements")
+    THROW_IF(chunkedList.end() - (chunkedList.begin() + i) != static_cast<std::ptrdiff_t>(expected.size()) - i,
+             "Iterator distance does not match the pushed elements")
+  }
+
+  THROW_IF(!(chunkedList.begin() < chunkedList.begin() + 1), "Iterators before the old front are not ordered")
+
+  performTask("Popping from both ends after pushing to the front");
+  chunkedList.VARIANT_CODE(popFront, pop_front)(ChunkSize + 1);
+  expected.erase(expected.begin(), expected.begin() + ChunkSize + 1);
+  chunkedList.pop();
+  expected.pop_back();
+
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Popping after pushing to the front failed")
+
+  performTask("Sorting and erasing after pushing to the front");
+  chunkedList.sort();
+  std::ranges::sort(expected);
+  chunkedList.erase(chunkedList.begin() + 1, chunkedList.begin() + ChunkSize + 2);
+  expected.erase(expected.begin() + 1, expected.begin() + ChunkSize + 2);
+
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Sorting or erasing after pushing to the front failed")
+
+  performTask("Destroying elements pushed to the front");
+  {
+    ChunkedListType<LiveCounter, ChunkSize> counters{};
+
+    for (int i = 0; i < 2 * ChunkSize + 1; ++i)
+      counters.VARIANT_CODE(emplaceFront, emplace_front)(i);
+
+    THROW_IF(counters.front().getValue() != 2 * ChunkSize || counters.back().getValue() != 0,
+             "Unexpected elements after pushing LiveCounters to the front")
+  }
+
+  THROW_IF(LiveCounter::liveCount != 0, "Elements were leaked")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::SnapshotSaving() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+
+  const std::filesystem::path path = std::filesystem::temp_directory_path()
+                                     / ("chunked_list_snapshot_" + std::to_string(getpid()) + ".bin");
+
+  ListType chunkedList{};
+
+  for (int i = 0; i < 10 * ChunkSize + 3; ++i)
+    chunkedList.push(i);
+
+  // leave partially filled Chunks at the front and in the middle
+  chunkedList.VARIANT_CODE(popFront, pop_front)(ChunkSize / 2 + 1);
+  chunkedList.VARIANT_CODE(pushFront, push_front)(-1);
+  chunkedList.erase(chunkedList.begin() + 2 * ChunkSize);
+
+  performTask("Saving to a file");
+  chunkedList.save(path);
+
+  performTask("Mapping the saved file");
+  {
+    const MappedChunkedList<DefaultT, ChunkSize> mappedList{path};
+
+    THROW_IF(mappedList.size() != chunkedList.size(), "Mapped snapshot has the wrong size")
+    THROW_IF(!std::ranges::equal(mappedList, chunkedList), "Mapped snapshot does not match the saved elements")
+    THROW_IF(mappedList[ChunkSize] != chunkedList[ChunkSize], "Indexing the mapped snapshot failed")
+    THROW_IF(mappedList.front() != -1 || mappedList.back() != chunkedList.back(), "Unexpected front or back element")
+    THROW_IF(!mappedList.verify(), "Checksum of an unmodified snapshot does not match")
+
+    std::vector<DefaultT> copied{};
+    segmented::copy(mappedList, std::back_inserter(copied));
+
+    THROW_IF(!std::ranges::equal(copied, chunkedList), "Copying the mapped snapshot a Chunk at a time failed")
+  }
+
+  performTask("Saving to a stream");
+  std::ostringstream stream{};
+  chunkedList.save(stream);
+
+  std::ifstream file{path, std::ios_base::binary};
+  const std::string fileContents{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  file.close();
+
+  THROW_IF(stream.str() != fileContents, "Saving to a stream and to a file wrote different bytes")
+
+  performTask("Detecting a corrupted snapshot");
+  {
+    std::fstream corrupted{path, std::ios_base::binary | std::ios_base::in | std::ios_base::out};
+    corrupted.seekp(sizeof(snapshot::header) + sizeof(DefaultT));
+    corrupted.put('\x7f');
+  }
+
+  THROW_IF((MappedChunkedList<DefaultT, ChunkSize>{path}.verify()), "Corrupted snapshot passed verification")
+
+  performTask("Rejecting a snapshot of another type");
+  bool rejected = false;
+
+  try {
+    const MappedChunkedList<short, ChunkSize> mappedList{path};
+  } catch (const std::runtime_error &) {
+    rejected = true;
+  }
+
+  THROW_IF(!rejected, "Snapshot of another type was mapped")
+
+  performTask("Saving an empty ChunkedList");
+  ListType{}.save(path);
+
+  THROW_IF(!(MappedChunkedList<DefaultT, ChunkSize>{path}.empty()), "Mapped empty snapshot is not empty")
+
+  std::filesystem::remove(path);
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::Formatting() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+
+  performTask("Formatting empty ChunkedLists");
+  {
+    const ListType emptyList{};
+    std::ostringstream os{};
+    os << emptyList;
+
+    THROW_IF(os.str() != "[]", "Inserting an empty ChunkedList into an ostream failed")
+    THROW_IF(!emptyList.concat().empty(), "Concatenating an empty ChunkedList failed")
+    THROW_IF(emptyList.VARIANT_CODE(formattedSize, formatted_size)() != 0, "Empty ChunkedList has a formatted size")
+
+    const ChunkedListType<std::string, ChunkSize> emptyStrings{};
+    THROW_IF(!emptyStrings.concat().empty(), "Concatenating an empty ChunkedList of strings failed")
+  }
+
+  performTask("Formatting a single element");
+  ListType chunkedList{};
+  chunkedList.push(7);
+
+  THROW_IF(chunkedList.concat(" ") != "7", "Concatenating a single element failed")
+
+  performTask("Formatting integers");
+  chunkedList.push(-12);
+  chunkedList.push(std::numeric_limits<DefaultT>::min());
+  chunkedList.push(std::numeric_limits<DefaultT>::max());
+  chunkedList.push(0);
+
+  std::string expected = "7, -12, " + std::to_string(std::numeric_limits<DefaultT>::min()) + ", "
+                         + std::to_string(std::numeric_limits<DefaultT>::max()) + ", 0";
+
+  const ListType &constList = chunkedList;
+
+  THROW_IF(constList.concat() != expected, "Concatenating integers failed")
+  THROW_IF(constList.VARIANT_CODE(formattedSize, formatted_size)() != expected.size(), "Unexpected formatted size")
+
+  std::string output = "values: ";
+  constList.VARIANT_CODE(formatTo, format_to)(output, ";");
+  std::ranges::replace(expected, ' ', '\0');
+  std::erase(expected, '\0');
+  std::ranges::replace(expected, ',', ';');
+
+  THROW_IF(output != "values: " + expected, "Appending to a string failed")
+
+  performTask("Formatting into a buffer");
+  std::array<char, 64> buffer{};
+  const auto [end, error] = constList.VARIANT_CODE(formatTo, format_to)(buffer.data(), buffer.data() + buffer.size(), ";");
+
+  THROW_IF(error != std::errc{} || std::string_view(buffer.data(), end) != expected, "Formatting into a buffer failed")
+
+  const auto [shortEnd, shortError] = constList.VARIANT_CODE(formatTo, format_to)(buffer.data(), buffer.data() + 8, ";");
+
+  THROW_IF(shortError != std::errc::value_too_large, "Formatting into a buffer which is too small succeeded")
+
+  performTask("Inserting more elements than the buffer holds into an ostream");
+  ListType longList{};
+  std::string longExpected = "[";
+
+  for (int i = 0; i < 1000; ++i) {
+    longList.push(i * 1001);
+    longExpected += (i ? ", " : "") + std::to_string(i * 1001);
+  }
+
+  longExpected += ']';
+
+  std::ostringstream os{};
+  os << longList;
+
+  THROW_IF(os.str() != longExpected, "Inserting a long ChunkedList into an ostream failed")
+
+  performTask("Formatting floating-point numbers and strings");
+  ChunkedListType<double, ChunkSize> doubles{};
+  doubles.push(0.5);
+  doubles.push(-1e300);
+  doubles.push(0.1);
+
+  THROW_IF(doubles.concat() != "0.5, -1e+300, 0.1", "Concatenating floating-point numbers failed")
+
+  performTask("Formatting floating-point numbers alike everywhere");
+  const ChunkedListType<double, ChunkSize> thirds{1.0 / 3, -2.0 / 3, 1e-7 / 3};
+  const std::string thirdsExpected = "0.333333, -0.666667, 3.33333e-08";
+
+  std::string thirdsFormatted{};
+  thirds.VARIANT_CODE(formatTo, format_to)(thirdsFormatted, ", ");
+
+  os.str("");
+  os << thirds;
+
+  THROW_IF(thirds.concat() != thirdsExpected, "Concatenating did not format with a precision of 6")
+  THROW_IF(thirdsFormatted != thirdsExpected, "Formatting to a string did not format with a precision of 6")
+  THROW_IF(os.str() != '[' + thirdsExpected + ']', "Inserting into an ostream did not format with a precision of 6")
+  THROW_IF(thirds.VARIANT_CODE(formattedSize, formatted_size)(", ") != thirdsExpected.size(),
+           "The formatted size disagrees with the formatted floating-point numbers")
+#ifdef __cpp_lib_format
+  THROW_IF(std::format("{}", thirds) != '[' + thirdsExpected + ']', "std::format did not format with a precision of 6")
+#endif
+
+  ChunkedListType<std::string, ChunkSize> strings{};
+  strings.push("a");
+  strings.push("bc");
+
+  os.str("");
+  os << strings;
+
+  THROW_IF(os.str() != "[a, bc]" || strings.concat("-") != "a-bc", "Formatting strings failed")
+
+  performTask("Inserting into streams whose formatting state has been changed");
+  doubles.push(0.1234567);
+
+  // the ChunkedList should be inserted as its elements would be one at a time into the same stream, padding each
+  const auto checkStreamState = [&](const auto &list, const auto &setState, const char *message) {
+    std::ostringstream actual{}, expectedStream{};
+    setState(actual);
+    setState(expectedStream);
+
+    actual << list;
+    const std::streamsize width = expectedStream.width(0);
+    expectedStream << '[';
+
+    for (auto iterator = list.begin(); iterator != list.end(); ++iterator) {
+      expectedStream << (iterator == list.begin() ? "" : ", ");
+      expectedStream.width(width);
+      expectedStream << *iterator;
+    }
+
+    expectedStream << ']';
+
+    THROW_IF(actual.str() != expectedStream.str(), message)
+  };
+
+  checkStreamState(doubles, [](std::ostream &) {}, "Inserting floating-point numbers ignored the default precision");
+  checkStreamState(doubles, [](std::ostream &stream) { stream << std::setprecision(3); },
+                   "Inserting floating-point numbers ignored the precision");
+  checkStreamState(doubles, [](std::ostream &stream) { stream << std::fixed << std::setprecision(2); },
+                   "Inserting floating-point numbers ignored std::fixed");
+  checkStreamState(doubles, [](std::ostream &stream) { stream << std::setprecision(40); },
+                   "Inserting floating-point numbers ignored a long precision");
+  checkStreamState(chunkedList, [](std::ostream &stream) { stream << std::hex; },
+                   "Inserting integers ignored std::hex");
+  checkStreamState(chunkedList, [](std::ostream &stream) { stream << std::showpos << std::setw(4); },
+                   "Inserting integers ignored std::showpos and the width");
+}
+
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::MemoryStatistics() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+
+  performTask("Reading the statistics of an empty ChunkedList");
+  ListType chunkedList{};
+
+  auto stats = chunkedList.stats();
+
+  THROW_IF(stats.chunkCount != 1 || stats.elementCount != 0 || stats.spareChunkCount != 0,
+           "Unexpected counts for an empty ChunkedList")
+  THROW_IF(stats.bytesWasted != ChunkSize * sizeof(DefaultT) || stats.fillRatio != 0,
+           "An empty ChunkedList should waste its whole Chunk")
+  THROW_IF(stats.bytesAllocated < ChunkSize * sizeof(DefaultT), "An empty ChunkedList should allocate a Chunk")
+
+  performTask("Reading the statistics of full and partial Chunks");
+  constexpr size_t elementCount = ChunkSize * 4 + 1;
+
+  for (size_t i = 0; i < elementCount; ++i)
+    chunkedList.push(static_cast<DefaultT>(i));
+
+  stats = chunkedList.stats();
+
+  THROW_IF(stats.chunkCount != 5 || stats.elementCount != elementCount, "Unexpected counts after pushing")
+  THROW_IF(stats.bytesWasted != (ChunkSize - 1) * sizeof(DefaultT), "Only the back Chunk should waste storage")
+  THROW_IF(stats.fillRatio != static_cast<double>(elementCount) / static_cast<double>(ChunkSize * 5),
+           "Unexpected fill ratio after pushing")
+
+  const size_t allocatedWithFiveChunks = stats.bytesAllocated;
+
+  performTask("Reading the statistics after popping from both ends");
+  chunkedList.VARIANT_CODE(popFront, pop_front)();
+
+  for (size_t i = 0; i < ChunkSize; ++i)
+    chunkedList.pop();
+
+  stats = chunkedList.stats();
+
+  THROW_IF(stats.elementCount != elementCount - ChunkSize - 1, "Unexpected element count after popping")
+  THROW_IF(stats.bytesWasted != (stats.chunkCount * ChunkSize - stats.elementCount) * sizeof(DefaultT),
+           "Popped slots should count as wasted storage")
+  THROW_IF(stats.chunkCount + stats.spareChunkCount > 5 || stats.bytesAllocated > allocatedWithFiveChunks,
+           "Popping shouldn't allocate anything")
+
+  chunkedList.VARIANT_CODE(shrinkToFit, shrink_to_fit)();
+
+  THROW_IF(chunkedList.stats().spareChunkCount != 0, "Shrinking should leave no spare Chunks")
+
+#ifdef CHUNKED_LIST_COUNTERS
+  performTask("Counting pushes, pops, allocations and Chunk hops");
+  ListType::VARIANT_CODE(resetCounters, reset_counters)();
+
+  {
+    ListType counted{};
+
+    for (size_t i = 0; i < ChunkSize * 3; ++i)
+      counted.push(static_cast<DefaultT>(i));
+
+    counted.VARIANT_CODE(pushFront, push_front)(0);
+    counted.pop();
+    counted.VARIANT_CODE(popFront, pop_front)(2);
+
+    // popping the back Chunk counts each of its elements
+    const size_t sizeBeforePopChunk = counted.size();
+    counted.VARIANT_CODE(popChunk, pop_chunk)();
+    const size_t backCount = sizeBeforePopChunk - counted.size();
+
+    auto counters = ListType::counters();
+
+    THROW_IF(counters.pushes != ChunkSize * 3 + 1 || counters.pops != 3 + backCount, "Unexpected push and pop counts")
+    THROW_IF(counters.chunkAllocations - counters.chunkDeallocations
+             != counted.stats().chunkCount + counted.stats().spareChunkCount,
+             "Every allocated and deallocated Chunk should be counted")
+
+    DefaultT sum = 0;
+
+    for (const DefaultT value: counted)
+      sum += value;
+
+    THROW_IF(sum == 0 || ListType::counters().chunkHops < counted.stats().chunkCount - 1,
+             "Iterating should hop through every Chunk")
+
+    const auto &constCounted = counted;
+    const size_t hopsBefore = ListType::counters().chunkHops;
+
+    for (auto chunkIt = constCounted.VARIANT_CODE(beginChunk, begin_chunk)();
+         chunkIt != constCounted.VARIANT_CODE(endChunk, end_chunk)(); chunkIt++) {
+    }
+
+    THROW_IF(ListType::counters().chunkHops - hopsBefore != counted.stats().chunkCount,
+             "Postfix increments should count their Chunk hops")
+  }
+
+  const auto counters = ListType::counters();
+
+  THROW_IF(counters.chunkDeallocations != counters.chunkAllocations,
+           "Every Chunk should be deallocated with its ChunkedList")
+#endif
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::AutomaticChunkSizes() {
+  using chunked_list_utility::auto_size;
+  using chunked_list_utility::chunk_bytes;
+
+  // the budgets and element sizes vary with the ChunkSize, so that each run fits a different number of elements
+  constexpr size_t targetBytes = ChunkSize * 128;
+  using Element = std::array<char, ChunkSize * 12 + 1>;
+
+  constexpr size_t intChunkSize = auto_size<DefaultT, targetBytes>;
+  constexpr size_t elementChunkSize = auto_size<Element, targetBytes>;
+
+  using IntChunk = std::remove_pointer_t<decltype(std::declval<ChunkedListAccessor<DefaultT, intChunkSize>>().getFront())>;
+  using ElementChunk = std::remove_pointer_t<decltype(std::declval<ChunkedListAccessor<Element, elementChunkSize>>().getFront())>;
+
+  performTask("Choosing the largest Chunk Sizes which fit the budget");
+  THROW_IF(sizeof(IntChunk) > targetBytes || chunk_bytes<DefaultT>(intChunkSize + 1) <= targetBytes,
+           "auto_size should choose the largest ChunkSize of ints which fits the budget")
+  THROW_IF(sizeof(ElementChunk) > targetBytes && elementChunkSize != 1, "A Chunk of elements exceeds the budget")
+  THROW_IF(chunk_bytes<Element>(elementChunkSize + 1) <= targetBytes,
+           "auto_size should choose the largest ChunkSize of elements which fits the budget")
+  constexpr size_t oversizedChunkSize = auto_size<std::array<char, targetBytes * 2>, targetBytes>;
+  THROW_IF(oversizedChunkSize != 1, "Elements larger than the budget should get a Chunk each")
+
+  performTask("Using an automatic Chunk Size");
+  ChunkedListType<DefaultT, intChunkSize> chunkedList{};
+
+  for (size_t i = 0; i < intChunkSize * 3 + 1; ++i)
+    chunkedList.push(static_cast<DefaultT>(i));
+
+  THROW_IF(chunkedList.stats().chunkCount != 4, "Pushing should fill whole Chunks of the automatic Chunk Size")
+
+  for (size_t i = 0; i < chunkedList.size(); ++i)
+    THROW_IF(chunkedList[i] != static_cast<DefaultT>(i), "Indexing a ChunkedList of an automatic Chunk Size failed")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::StructureOfArrays() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+  using SoAType = ChunkedSoA<ChunkSize, int64_t, DefaultT, double, std::string>;
+  namespace simd = chunked_list_utility::simd;
+  namespace segmented = chunked_list_utility::segmented;
+
+  static_assert(std::ranges::random_access_range<typename SoAType::template Column<1> >);
+  static_assert(segmented::chunked_range<typename SoAType::template ConstColumn<1> >);
+
+  SoAType records{};
+  ListType values{};
+
+  performTask("Pushing records");
+  for (int i = 0; i < 500; ++i) {
+    const DefaultT value = (i * 37) % 101;
+    records.push(1000 - i, value, i * 0.5, std::to_string(i));
+    values.push(value);
+  }
+
+  THROW_IF(records.size() != 500 || records.empty(), "Unexpected size after pushing records")
+
+  auto [timestamp, value, weight, name] = records[3];
+  THROW_IF(timestamp != 997 || value != values[3] || weight != 1.5 || name != "3", "Indexing records failed")
+
+  THROW_IF(std::get<0>(records.front()) != 1000 || std::get<3>(records.back()) != "499",
+           "Accessing the front and back records failed")
+
+  performTask("Iterating over records and columns");
+  size_t index = 0;
+
+  for (auto [recordTimestamp, recordValue, recordWeight, recordName]: records) {
+    THROW_IF(recordValue != values[index] || recordName != std::to_string(index), "Iterating over records failed")
+    ++index;
+  }
+
+  auto valueColumn = records.template column<1>();
+  THROW_IF(!std::ranges::equal(valueColumn, values), "Iterating over a column failed")
+
+  size_t chunkElements = 0;
+
+  for (const auto chunk: valueColumn.chunks()) {
+    THROW_IF(chunk.size() > ChunkSize, "A column span exceeds the Chunk Size")
+    chunkElements += chunk.size();
+  }
+
+  THROW_IF(chunkElements != records.size(), "The column spans don't cover every record")
+
+  performTask("Assigning through proxy references");
+  std::get<3>(records[7]) = "seven";
+  valueColumn[8] = 1000;
+  values[8] = 1000;
+
+  THROW_IF(std::get<3>(records[7]) != "seven" || std::get<1>(records[8]) != 1000,
+           "Assigning through proxy references failed")
+
+  performTask("Scanning columns with the segmented algorithms and SIMD kernels");
+  const auto &constRecords = records;
+
+  THROW_IF(simd::sum(constRecords.template column<1>()) != simd::sum(values), "Summing a column failed")
+  THROW_IF(simd::count(constRecords.template column<1>(), values[11]) != simd::count(values, values[11]),
+           "Counting in a column failed")
+  const auto [minTimestamp, maxTimestamp] = simd::minmax(records.template column<0>());
+  THROW_IF(minTimestamp != 501 || maxTimestamp != 1000, "Finding the minimum and maximum of a column failed")
+
+  auto weightColumn = records.template column<2>();
+  segmented::fill(weightColumn, 2.0);
+  THROW_IF(simd::sum(weightColumn) != 1000.0, "Filling a column failed")
+
+  performTask("Sorting records by a column");
+  records.template sortBy<1>();
+
+  THROW_IF(!std::ranges::is_sorted(records.template column<1>()), "Sorting records by a column failed")
+
+  for (const auto [recordTimestamp, recordValue, recordWeight, recordName]: records) {
+    if (recordName == "seven") continue;
+    THROW_IF(recordName != std::to_string(1000 - recordTimestamp), "Sorting separated the fields of a record")
+  }
+
+  records.template sortBy<0, std::less<>, chunked_list_utility::RadixSort>();
+
+  THROW_IF(std::get<0>(records.front()) != 501 || std::get<3>(records.back()) != "0",
+           "Radix sorting records by a column failed")
+
+  performTask("Copying and popping records");
+  SoAType copy = records;
+
+  for (int i = 0; i < 500; ++i)
+    records.pop();
+
+  records.pop();
+
+  THROW_IF(!records.empty() || copy.size() != 500 || std::get<0>(copy.back()) != 1000,
+           "Copying or popping records failed")
+
+  records = std::move(copy);
+  THROW_IF(records.size() != 500 || simd::sum(records.template column<0>()) != 375250, "Moving records failed")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::BulkErasure() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+  constexpr size_t elementCount = ChunkSize * 6 + 3;
+  const auto isEven = [](const DefaultT &value) { return value % 2 == 0; };
+
+  performTask(VARIANT_CODE("Calling eraseIf() on every even element", "Calling erase_if() on every even element"));
+  ListType chunkedList{};
+  std::vector<DefaultT> expected{};
+
+  for (size_t i = 0; i < elementCount; ++i) {
+    chunkedList.push(static_cast<DefaultT>(i));
+    expected.push_back(static_cast<DefaultT>(i));
+  }
+
+  size_t erased = chunkedList.VARIANT_CODE(eraseIf, erase_if)(isEven);
+  size_t expectedErased = std::erase_if(expected, isEven);
+
+  THROW_IF(erased != expectedErased, "Erasing the even elements returned the wrong count")
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Erasing the even elements left the wrong elements")
+
+  auto stats = chunkedList.stats();
+  THROW_IF(stats.chunkCount != (expected.size() + ChunkSize - 1) / ChunkSize,
+           "Erasing should release the Chunks left empty")
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    THROW_IF(chunkedList[i] != expected[i], "Indexing after erasing the even elements failed")
+
+  performTask("Calling retain()");
+  erased = chunkedList.retain([](const DefaultT &value) { return value % 3 == 0; });
+  expectedErased = std::erase_if(expected, [](const DefaultT &value) { return value % 3 != 0; });
+
+  THROW_IF(erased != expectedErased, "Retaining returned the wrong count")
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Retaining left the wrong elements")
+
+  performTask("Erasing no elements and every element");
+  THROW_IF(chunkedList.VARIANT_CODE(eraseIf, erase_if)([](const DefaultT &) { return false; }) != 0,
+           "Erasing no elements should return 0")
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Erasing no elements changed the ChunkedList")
+
+  erased = chunkedList.VARIANT_CODE(eraseIf, erase_if)([](const DefaultT &) { return true; });
+  THROW_IF(erased != expected.size() || !chunkedList.empty(), "Erasing every element should empty the ChunkedList")
+
+  chunkedList.push(1);
+  THROW_IF(chunkedList.size() != 1 || chunkedList.front() != 1, "Pushing after erasing every element failed")
+
+  performTask("Erasing from a ChunkedList with a partial front Chunk and partial inner Chunks");
+  chunkedList = ListType{};
+  expected.clear();
+
+  for (size_t i = 0; i < elementCount; ++i) {
+    chunkedList.push(static_cast<DefaultT>(i));
+    expected.push_back(static_cast<DefaultT>(i));
+  }
+
+  for (size_t i = 0; i < ChunkSize + 1; ++i) {
+    chunkedList.VARIANT_CODE(pushFront, push_front)(static_cast<DefaultT>(i + elementCount));
+    expected.insert(expected.begin(), static_cast<DefaultT>(i + elementCount));
+  }
+
+  for (size_t offset = ChunkSize * 2; offset < expected.size(); offset += ChunkSize * 2) {
+    chunkedList.insert(chunkedList.begin() + offset, 7);
+    expected.insert(expected.begin() + static_cast<std::ptrdiff_t>(offset), 7);
+    chunkedList.erase(chunkedList.begin() + offset / 2);
+    expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(offset / 2));
+  }
+
+  erased = chunkedList.VARIANT_CODE(eraseIf, erase_if)(isEven);
+  expectedErased = std::erase_if(expected, isEven);
+
+  THROW_IF(erased != expectedErased, "Erasing across partial Chunks returned the wrong count")
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "Erasing across partial Chunks left the wrong elements")
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    THROW_IF(chunkedList[i] != expected[i], "Indexing after erasing across partial Chunks failed")
+
+  performTask("Erasing elements which own memory");
+  ChunkedListType<std::string, ChunkSize> strings{};
+  std::vector<std::string> expectedStrings{};
+
+  for (size_t i = 0; i < elementCount; ++i) {
+    strings.push(std::string(32, static_cast<char>('a' + i % 26)));
+    expectedStrings.push_back(std::string(32, static_cast<char>('a' + i % 26)));
+  }
+
+  const auto isVowel = [](const std::string &value) { return std::string_view{"aeiou"}.find(value.front()) != std::string_view::npos; };
+  erased = strings.VARIANT_CODE(eraseIf, erase_if)(isVowel);
+  expectedErased = std::erase_if(expectedStrings, isVowel);
+
+  THROW_IF(erased != expectedErased, "Erasing strings returned the wrong count")
+  THROW_IF(!std::ranges::equal(strings, expectedStrings), "Erasing strings left the wrong elements")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::SlabAllocation() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+  constexpr size_t chunkBytes = chunked_list_utility::chunk_bytes<DefaultT>(ChunkSize);
+  constexpr size_t chunkAlignment = chunked_list_utility::chunk_alignment<DefaultT>;
+  constexpr size_t elementCount = ChunkSize * 40 + 3;
+
+  const auto slab = std::make_shared<ChunkSlab>(chunkBytes, chunkAlignment);
+
+  {
+    performTask("Pushing to a ChunkedList allocated from a ChunkSlab");
+    ListType chunkedList{slab};
+
+    THROW_IF(chunkedList.slab() != slab, "The ChunkedList should keep the ChunkSlab it was given")
+    THROW_IF(slab->getBlockCount() != 1, "An empty ChunkedList should allocate one block")
+
+    for (size_t i = 0; i < elementCount; ++i)
+      chunkedList.push(static_cast<DefaultT>(i));
+
+    for (size_t i = 0; i < elementCount; ++i)
+      THROW_IF(chunkedList[i] != static_cast<DefaultT>(i), "Indexing a ChunkedList allocated from a ChunkSlab failed")
+
+    auto stats = chunkedList.stats();
+
+    THROW_IF(slab->getBlockCount() != stats.chunkCount + stats.spareChunkCount,
+             "Every Chunk should be a block of the ChunkSlab")
+    THROW_IF(slab->getSlabCount() != (stats.chunkCount * slab->getBlockSize() + ChunkSlab::slabSize - 1)
+             / ChunkSlab::slabSize, "The blocks should be packed into as few slabs as possible")
+
+    const auto firstAddress = reinterpret_cast<uintptr_t>(&chunkedList.front());
+    THROW_IF(firstAddress % chunkAlignment != 0, "The elements of a Chunk from a ChunkSlab should be aligned")
+
+    performTask("Popping and erasing from a ChunkedList allocated from a ChunkSlab");
+    chunkedList.VARIANT_CODE(setRetentionPolicy, set_retention_policy)(KeepSpareChunks, 0);
+
+    for (size_t i = 0; i < ChunkSize * 10; ++i)
+      chunkedList.pop();
+
+    chunkedList.VARIANT_CODE(eraseIf, erase_if)([](const DefaultT &value) { return value % 2 == 0; });
+    stats = chunkedList.stats();
+
+    THROW_IF(slab->getBlockCount() != stats.chunkCount + stats.spareChunkCount,
+             "Released Chunks should be returned to the ChunkSlab")
+
+    performTask("Copying, moving and swapping a ChunkedList allocated from a ChunkSlab");
+    ListType copy{chunkedList};
+
+    THROW_IF(copy.slab() != slab || copy != chunkedList, "A copy should share the ChunkSlab and hold the same elements")
+
+    ListType moved{std::move(copy)};
+    THROW_IF(moved.slab() != slab || moved != chunkedList, "A moved ChunkedList should keep the ChunkSlab")
+
+    ListType heapList{};
+    heapList.push(1);
+    heapList.swap(moved);
+
+    THROW_IF(heapList.slab() != slab || moved.slab() != nullptr, "Swapping should exchange the ChunkSlabs")
+    THROW_IF(heapList != chunkedList || moved.size() != 1, "Swapping should exchange the elements")
+
+    performTask("Splicing between ChunkedLists of different allocators");
+    const size_t sizeBefore = chunkedList.size();
+    std::vector<DefaultT> expected{chunkedList.begin(), chunkedList.end()};
+    expected.insert(expected.end(), moved.begin(), moved.end());
+    expected.insert(expected.end(), heapList.begin(), heapList.end());
+
+    chunkedList.splice(std::move(moved));
+    chunkedList.splice(std::move(heapList));
+
+    THROW_IF(chunkedList.size() != expected.size() || !std::ranges::equal(chunkedList, expected),
+             "Splicing should keep every element in order")
+    THROW_IF(chunkedList.size() <= sizeBefore || !heapList.empty(), "Splicing should empty the other ChunkedList")
+
+    // the moved-from copy keeps allocating from the ChunkSlab, though it is left without any Chunk until it is used
+    stats = chunkedList.stats();
+    const auto heapStats = heapList.stats(), copyStats = copy.stats();
+
+    THROW_IF(slab->getBlockCount() != stats.chunkCount + stats.spareChunkCount + heapStats.chunkCount
+             + heapStats.spareChunkCount + copyStats.chunkCount + copyStats.spareChunkCount,
+             "Spliced Chunks should stay with the ChunkSlab they were allocated from")
+  }
+
+  THROW_IF(slab->getBlockCount() != 0, "Destroying the ChunkedLists should return every block to the ChunkSlab")
+
+  performTask("Rejecting a ChunkSlab of blocks too small for a Chunk");
+  bool rejected = false;
+
+  try {
+    ListType chunkedList{std::make_shared<ChunkSlab>(chunkBytes - chunkAlignment, chunkAlignment)};
+  } catch (const std::invalid_argument &) {
+    rejected = true;
+  }
+
+  THROW_IF(!rejected, "A ChunkSlab of blocks too small for a Chunk should be rejected")
+
+  performTask("Allocating from ChunkSlabs with each NUMA policy");
+
+  for (const NumaPolicy policy: {LocalNode, InterleaveNodes, BindNode}) {
+    try {
+      ListType chunkedList{std::make_shared<ChunkSlab>(chunkBytes, chunkAlignment, policy, 0)};
+
+      for (size_t i = 0; i < elementCount; ++i)
+        chunkedList.push(static_cast<DefaultT>(i));
+
+      THROW_IF(chunkedList.back() != static_cast<DefaultT>(elementCount - 1),
+               "Pushing to a ChunkedList of a NUMA policy failed")
+    } catch (const std::system_error &error) {
+      // containers may forbid the memory policy system calls, or not support NUMA at all
+      THROW_IF(error.code().value() != ENOSYS && error.code().value() != EPERM,
+               "Applying a NUMA policy to a ChunkSlab failed")
+    }
+  }
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::Snapshots() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+  using SnapshotType = typename ListType::VARIANT_CODE(Snapshot, snapshot_view);
+  constexpr size_t elementCount = ChunkSize * 20 + 3;
+
+  static_assert(segmented::chunked_range<SnapshotType>);
+
+  const auto matchesRange = [](const SnapshotType &snapshot, const size_t first, const size_t count) {
+    if (snapshot.size() != count)
+      return false;
+
+    for (size_t i = 0; i < count; ++i) {
+      if (snapshot[i] != static_cast<DefaultT>(first + i))
+        return false;
+    }
+
+    size_t expected = first;
+
+    for (const DefaultT value: snapshot) {
+      if (value != static_cast<DefaultT>(expected++))
+        return false;
+    }
+
+    return expected == first + count;
+  };
+
+  performTask("Taking a snapshot and pushing to the ChunkedList");
+  ListType chunkedList{};
+
+  for (size_t i = 0; i < elementCount; ++i)
+    chunkedList.push(static_cast<DefaultT>(i));
+
+  const SnapshotType snapshot = chunkedList.snapshot();
+
+  for (size_t i = 0; i < ChunkSize * 3; ++i)
+    chunkedList.push(-1);
+
+  chunkedList.VARIANT_CODE(pushFront, push_front)(-1);
+
+  THROW_IF(!matchesRange(snapshot, 0, elementCount), "Pushing changed the elements of a snapshot")
+
+  performTask("Modifying the elements of the ChunkedList through indexing, front and back");
+  chunkedList[elementCount / 2] = -2;
+  chunkedList.front() = -2;
+  chunkedList.back() = -2;
+
+  THROW_IF(!matchesRange(snapshot, 0, elementCount), "Modifying elements changed a snapshot")
+  THROW_IF(chunkedList[elementCount / 2] != -2 || chunkedList.front() != -2 || chunkedList.back() != -2,
+           "Modifying the elements of a snapshotted ChunkedList failed")
+
+  performTask("Popping from both ends of the ChunkedList");
+  chunkedList.VARIANT_CODE(popFront, pop_front)();
+  chunkedList.VARIANT_CODE(popFront, pop_front)(ChunkSize + 1);
+
+  while (chunkedList.size() > ChunkSize * 2)
+    chunkedList.pop();
+
+  THROW_IF(!matchesRange(snapshot, 0, elementCount), "Popping changed a snapshot")
+
+  performTask("Sorting and erasing from the ChunkedList");
+  const SnapshotType laterSnapshot = chunkedList.snapshot();
+  std::vector<DefaultT> laterElements{laterSnapshot.begin(), laterSnapshot.end()};
+
+  chunkedList.sort();
+  chunkedList.VARIANT_CODE(eraseIf, erase_if)([](const DefaultT &value) { return value % 2 == 0; });
+
+  THROW_IF(!matchesRange(snapshot, 0, elementCount), "Sorting and erasing changed a snapshot")
+  THROW_IF(!std::ranges::equal(laterSnapshot, laterElements), "Sorting and erasing changed a later snapshot")
+
+  performTask("Copying and moving snapshots");
+  SnapshotType copy{snapshot};
+  SnapshotType moved{std::move(copy)};
+  SnapshotType assigned{};
+
+  THROW_IF(!assigned.empty() || assigned.begin() != assigned.end(), "A default snapshot should be empty")
+
+  assigned = moved;
+
+  THROW_IF(!matchesRange(moved, 0, elementCount) || !matchesRange(assigned, 0, elementCount),
+           "Copying a snapshot failed")
+
+  performTask("Using the segmented algorithms on a snapshot");
+  DefaultT sum = 0;
+  segmented::for_each(snapshot, [&sum](const DefaultT value) { sum += value; });
+
+  THROW_IF(sum != static_cast<DefaultT>(elementCount * (elementCount - 1) / 2), "Segmented for_each of a snapshot failed")
+
+  std::vector<DefaultT> copied(elementCount);
+  segmented::copy(snapshot, copied.begin());
+
+  THROW_IF(!std::ranges::equal(copied, snapshot), "Segmented copy of a snapshot failed")
+
+  performTask("Modifying the ChunkedList through its iterators");
+  constexpr size_t iteratedCount = ChunkSize * 20;
+  ListType iterated{};
+
+  for (size_t i = 0; i < iteratedCount; ++i)
+    iterated.push(static_cast<DefaultT>(i));
+
+  // obtained before the snapshot, which shares every Chunk, the full back one included
+  const auto earlyBegin = iterated.begin();
+  const auto earlyEnd = iterated.end();
+  const SnapshotType iteratedSnapshot = iterated.snapshot();
+  const DefaultT *frontAddress = &std::as_const(iterated).front();
+
+  THROW_IF(iterated.end() - iterated.begin() != static_cast<std::ptrdiff_t>(iteratedCount)
+           || iterated.begin() + static_cast<std::ptrdiff_t>(iteratedCount) != iterated.end(),
+           "Traversing a snapshotted ChunkedList failed")
+  THROW_IF(&std::as_const(iterated).front() != frontAddress, "Traversing a ChunkedList shouldn't copy its Chunks")
+
+  *earlyBegin = -3;
+
+  THROW_IF(!matchesRange(iteratedSnapshot, 0, iteratedCount),
+           "Writing through an iterator obtained before a snapshot changed it")
+  THROW_IF(std::as_const(iterated).front() != -3, "Writing through an iterator obtained before a snapshot failed")
+
+  // the second iterator is left on the Chunk the first one copies, unless a Chunk holds a single element
+  const auto first = iterated.begin() + static_cast<std::ptrdiff_t>(ChunkSize * 5);
+  const auto second = first + 1;
+  *first = -100;
+  *second = -101;
+
+  THROW_IF(first + 1 != second || std::next(earlyBegin, iteratedCount) != earlyEnd,
+           "Iterators should stay comparable after their Chunks are copied")
+  THROW_IF(std::as_const(iterated)[ChunkSize * 5] != -100 || std::as_const(iterated)[ChunkSize * 5 + 1] != -101,
+           "Writing through an iterator left on a copied Chunk failed")
+
+  size_t visited = 0;
+
+  for (DefaultT &value: iterated) {
+    value = -value;
+    ++visited;
+  }
+
+  THROW_IF(visited != iteratedCount, "Iterating over a snapshotted ChunkedList should reach its end")
+  THROW_IF(!matchesRange(iteratedSnapshot, 0, iteratedCount), "Writing through iterators changed a snapshot")
+
+  std::vector<DefaultT> negated{};
+
+  for (size_t i = 0; i < iteratedCount; ++i)
+    negated.push_back(-static_cast<DefaultT>(i));
+
+  negated[0] = 3;
+  negated[ChunkSize * 5] = 100;
+  negated[ChunkSize * 5 + 1] = 101;
+
+  THROW_IF(!std::ranges::equal(std::as_const(iterated), negated),
+           "Writing through the iterators of a snapshotted ChunkedList failed")
+
+  performTask("Inserting through an iterator left on a copied Chunk");
+  const SnapshotType insertedSnapshot = iterated.snapshot();
+  const std::vector<DefaultT> insertedElements{insertedSnapshot.begin(), insertedSnapshot.end()};
+
+  const auto position = iterated.begin() + static_cast<std::ptrdiff_t>(ChunkSize * 2);
+  *std::next(position) = 7;
+  iterated.insert(position, 42);
+  iterated.erase(std::prev(iterated.end()));
+
+  THROW_IF(!std::ranges::equal(insertedSnapshot, insertedElements), "Inserting and erasing changed a snapshot")
+  THROW_IF(std::as_const(iterated)[ChunkSize * 2] != 42 || std::as_const(iterated)[ChunkSize * 2 + 2] != 7
+           || iterated.size() != iteratedCount, "Inserting through an iterator left on a copied Chunk failed")
+
+  performTask("Reading a snapshot after the ChunkedList is destroyed");
+  SnapshotType survivor{};
+
+  {
+    ListType temporary{};
+
+    for (size_t i = 0; i < elementCount; ++i)
+      temporary.push(static_cast<DefaultT>(i));
+
+    survivor = temporary.snapshot();
+
+    for (size_t i = 0; i < ChunkSize * 5; ++i)
+      temporary.pop();
+  }
+
+  THROW_IF(!matchesRange(survivor, 0, elementCount), "A snapshot should outlive its ChunkedList")
+
+  performTask("Snapshotting an empty ChunkedList");
+  ListType emptyList{};
+  const SnapshotType emptySnapshot = emptyList.snapshot();
+  emptyList.push(1);
+
+  THROW_IF(!emptySnapshot.empty() || emptySnapshot.begin() != emptySnapshot.end(),
+           "A snapshot of an empty ChunkedList should stay empty")
+}
+
+template<template <typename, size_t> typename ChunkedListType, size_t ChunkSize>
+void Tests::SingleWriterReading() {
+  using ListType = ChunkedListType<DefaultT, ChunkSize>;
+  using SharedListType = SingleWriterChunkedList<DefaultT, ChunkSize>;
+
+  static_assert(std::ranges::forward_range<typename SharedListType::View>);
+
+  constexpr int readerCount = 3;
+  constexpr int rounds = 400;
+
+  performTask("Reading a view while its Chunks are popped");
+  {
+    SharedListType sharedList{};
+
+    for (size_t i = 0; i < ChunkSize * 4; ++i)
+      sharedList.push(static_cast<DefaultT>(i));
+
+    const auto reader = sharedList.reader();
+
+    {
+      const auto view = reader.view();
+      auto iterator = view.begin();
+      std::advance(iterator, ChunkSize * 3);
+
+      // the back Chunk is retired while the iterator is in it, and mustn't be deallocated until the view is destroyed
+      sharedList.popChunk();
+      sharedList.pop();
+
+      auto expected = static_cast<DefaultT>(ChunkSize * 3);
+
+      for (; iterator != view.end(); ++iterator)
+        THROW_IF(*iterator != expected++, "A view should keep reading the elements popped after it was created")
+
+      THROW_IF(expected != static_cast<DefaultT>(ChunkSize * 4), "A view should reach every element it was created with")
+    }
+
+    const auto view = reader.view();
+
+    for (size_t i = 0; i < ChunkSize; ++i)
+      sharedList.push(-1);
+
+    size_t index = 0;
+
+    // a popped slot which is pushed to again is read either before or after the push
+    for (const DefaultT value: view) {
+      THROW_IF(value != static_cast<DefaultT>(index) && value != -1, "A view read an element which was never pushed")
+      ++index;
+    }
+
+    THROW_IF(sharedList.size() != ChunkSize * 4 - 1 || sharedList.back() != -1,
+             "Pushing after popping a SingleWriterChunkedList failed")
+  }
+
+  performTask("Pushing and popping from one thread while others read");
+  SharedListType sharedList{};
+  std::atomic<bool> writing{true};
+  std::atomic<bool> readerFailed{false};
+  std::vector<std::thread> readers{};
+
+  for (int i = 0; i < readerCount; ++i) {
+    readers.emplace_back([&] {
+      const auto reader = sharedList.reader();
+
+      while (writing.load()) {
+        const auto view = reader.view();
+        size_t readCount = 0;
+
+        // every element holds its own index, whichever pops and pushes overtake the view
+        for (const DefaultT value: view) {
+          if (value != static_cast<DefaultT>(readCount))
+            readerFailed = true;
+
+          ++readCount;
+        }
+
+        if (readCount > view.size())
+          readerFailed = true;
+      }
+    });
+  }
+
+  for (int round = 0; round < rounds; ++round) {
+    for (size_t i = 0; i < ChunkSize * 3 + 1; ++i)
+      sharedList.push(static_cast<DefaultT>(sharedList.size()));
+
+    for (size_t i = 0; i < ChunkSize * 2; ++i)
+      sharedList.pop();
+
+    if (round % 5 == 0)
+      sharedList.popChunk();
+  }
+
+  writing = false;
+
+  for (std::thread &reader: readers)
+    reader.join();
+
+  THROW_IF(readerFailed, "A reader observed an element which was popped or not yet constructed")
+
+  performTask("Copying the elements of a view");
+  const auto reader = sharedList.reader();
+  const auto view = reader.view();
+
+  ListType chunkedList{};
+  chunkedList.append(view);
+
+  std::vector<DefaultT> expected(sharedList.size());
+  std::iota(expected.begin(), expected.end(), 0);
+
+  THROW_IF(!std::ranges::equal(chunkedList, expected), "A view did not hold the elements which were left")
+}
@@ -0,0 +1,522 @@
+#include <ChunkedList.hpp>
+#include <ChunkSlab.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * ChunkedListBench measures ChunkedList against std::vector, std::deque and std::list, for each operation, element
+ * type, ChunkSize and size, along with SlabChunkedList, a ChunkedList allocating its Chunks from a ChunkSlab. Each
+ * measurement is repeated after warm-up runs, and reported as percentiles of the time per element, both as a table
+ * and, given --json, as JSON which can be compared between versions.
+ *
+ * Options:
+ *   --min-size N       The smallest size measured, 1000 by default
+ *   --max-size N       The largest size measured, 1000000 by default and up to 1e8. Sizes go up by factors of 10
+ *   --repetitions N    The number of measured runs, 7 by default
+ *   --warmup N         The number of unmeasured runs before them, 1 by default
+ *   --filter TEXT      Only runs the benchmarks whose name contains the text
+ *   --json PATH        Writes the results as JSON to the path
+ *   --numa POLICY      The NUMA policy of the ChunkSlabs: default, local, interleave or a node number
+ */
+
+namespace {
+  struct Options {
+    size_t minSize{1'000};
+    size_t maxSize{1'000'000};
+    size_t repetitions{7};
+    size_t warmup{1};
+    std::string filter{};
+    std::string jsonPath{};
+    NumaPolicy numaPolicy{DefaultNode};
+    int numaNode{0};
+  };
+
+  struct Result {
+    std::string name;
+    std::string container;
+    std::string element;
+    std::string operation;
+    size_t chunkSize;
+    size_t size;
+    /**
+     * @brief The nanoseconds per element of each repetition, sorted
+     */
+    std::vector<double> samples;
+
+    double percentile(const double fraction) const {
+      const double rank = fraction * static_cast<double>(samples.size() - 1);
+      const auto lower = static_cast<size_t>(std::floor(rank));
+      const size_t upper = std::min(lower + 1, samples.size() - 1);
+      return samples[lower] + (samples[upper] - samples[lower]) * (rank - static_cast<double>(lower));
+    }
+  };
+
+  Options options{};
+
+  std::vector<Result> results{};
+
+  /**
+   * @brief Keeps the compiler from optimising away a value which is never used
+   */
+  template<typename T>
+  void doNotOptimize(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+  }
+
+  /**
+   * @brief An element of 64 bytes, which sorts by its key
+   */
+  struct Padded64 {
+    uint64_t key;
+    std::array<uint64_t, 7> padding;
+
+    explicit Padded64(const uint64_t key = 0) : key{key}, padding{} {
+    }
+
+    bool operator<(const Padded64 &other) const {
+      return key < other.key;
+    }
+
+    bool operator==(const Padded64 &other) const {
+      return key == other.key;
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const Padded64 &value) {
+      return os << value.key;
+    }
+  };
+
+  static_assert(sizeof(Padded64) == 64);
+
+  /**
+   * @brief An int which ChunkedList doesn't prefetch Chunks ahead for, to measure what prefetching gains over int
+   */
+  struct UnprefetchedInt {
+    int value;
+
+    UnprefetchedInt(const int value = 0) : value{value} {
+    }
+
+    operator int() const {
+      return value;
+    }
+  };
+}
+
+template<>
+struct chunked_list_utility::prefetch_policy<UnprefetchedInt> {
+  static constexpr size_t distance = 0;
+  static constexpr size_t lines = 0;
+};
+
+namespace {
+
+  /**
+   * @brief A ChunkedList allocating its Chunks from its own ChunkSlab, so that its Chunks are packed into huge pages,
+   * which are released along with the ChunkedList
+   */
+  template<typename T, size_t ChunkSize>
+  class SlabChunkedList : public ChunkedList<T, ChunkSize> {
+    public:
+      SlabChunkedList()
+        : ChunkedList<T, ChunkSize>{
+          std::make_shared<ChunkSlab>(chunked_list_utility::chunk_bytes<T>(ChunkSize),
+                                      chunked_list_utility::chunk_alignment<T>, options.numaPolicy, options.numaNode)
+        } {
+      }
+  };
+
+  template<typename T>
+  T makeValue(std::mt19937_64 &engine) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      // longer than the small string buffer, so that each string allocates
+      return "element-" + std::to_string(engine()) + "-padding";
+    } else {
+      return T(static_cast<T>(engine() % 1'000'000'000));
+    }
+  }
+
+  template<typename T>
+  uint64_t digest(const T &value) {
+    if constexpr (std::is_same_v<T, std::string>)
+      return value.size();
+    else if constexpr (std::is_same_v<T, Padded64>)
+      return value.key;
+    else
+      return static_cast<uint64_t>(value);
+  }
+
+  template<typename T>
+  constexpr std::string_view elementName() {
+    if constexpr (std::is_same_v<T, int>) return "int";
+    else if constexpr (std::is_same_v<T, UnprefetchedInt>) return "unprefetched int";
+    else if constexpr (std::is_same_v<T, Padded64>) return "Padded64";
+    else return "std::string";
+  }
+
+  template<typename ContainerT>
+  struct ContainerTraits;
+
+  template<typename T, size_t ChunkSize>
+  struct ContainerTraits<ChunkedList<T, ChunkSize> > {
+    static constexpr std::string_view name = "ChunkedList";
+    static constexpr size_t chunkSize = ChunkSize;
+    static constexpr bool indexable = true;
+
+    static void push(ChunkedList<T, ChunkSize> &container, const T &value) { container.push(value); }
+
+    template<typename... Args>
+    static void emplace(ChunkedList<T, ChunkSize> &container, Args &&... args) {
+      container.emplace(std::forward<Args>(args)...);
+    }
+
+    static void pop(ChunkedList<T, ChunkSize> &container) { container.pop(); }
+  };
+
+  template<typename T, size_t ChunkSize>
+  struct ContainerTraits<SlabChunkedList<T, ChunkSize> > : ContainerTraits<ChunkedList<T, ChunkSize> > {
+    static constexpr std::string_view name = "SlabChunkedList";
+  };
+
+  template<typename ContainerT>
+  struct StandardContainerTraits {
+    static constexpr size_t chunkSize = 0;
+    static constexpr bool indexable = !std::is_same_v<ContainerT, std::list<std::ranges::range_value_t<ContainerT>> >;
+
+    static void push(ContainerT &container, const std::ranges::range_value_t<ContainerT> &value) {
+      container.push_back(value);
+    }
+
+    template<typename... Args>
+    static void emplace(ContainerT &container, Args &&... args) {
+      container.emplace_back(std::forward<Args>(args)...);
+    }
+
+    static void pop(ContainerT &container) { container.pop_back(); }
+  };
+
+  template<typename T>
+  struct ContainerTraits<std::vector<T> > : StandardContainerTraits<std::vector<T> > {
+    static constexpr std::string_view name = "std::vector";
+  };
+
+  template<typename T>
+  struct ContainerTraits<std::deque<T> > : StandardContainerTraits<std::deque<T> > {
+    static constexpr std::string_view name = "std::deque";
+  };
+
+  template<typename T>
+  struct ContainerTraits<std::list<T> > : StandardContainerTraits<std::list<T> > {
+    static constexpr std::string_view name = "std::list";
+  };
+
+  /**
+   * @brief Times the run function over a state made by the setup function before each run, which isn't timed
+   */
+  template<typename ContainerT, typename Setup, typename Run>
+  void measure(const std::string_view operation, const size_t size, Setup setup, Run run) {
+    using Traits = ContainerTraits<ContainerT>;
+    using T = std::ranges::range_value_t<ContainerT>;
+
+    std::string name = std::string{Traits::name} + '<' + std::string{elementName<T>()};
+
+    if (Traits::chunkSize)
+      name += ", " + std::to_string(Traits::chunkSize);
+
+    name += ">/" + std::string{operation} + '/' + std::to_string(size);
+
+    if (name.find(options.filter) == std::string::npos)
+      return;
+
+    Result result{
+      name, std::string{Traits::name}, std::string{elementName<T>()}, std::string{operation}, Traits::chunkSize, size,
+      {}
+    };
+
+    for (size_t repetition = 0; repetition < options.warmup + options.repetitions; ++repetition) {
+      auto state = setup();
+
+      const auto start = std::chrono::steady_clock::now();
+      run(state);
+      const auto end = std::chrono::steady_clock::now();
+
+      doNotOptimize(state);
+
+      if (repetition >= options.warmup)
+        result.samples.push_back(std::chrono::duration<double, std::nano>(end - start).count()
+                                 / static_cast<double>(size));
+    }
+
+    std::ranges::sort(result.samples);
+
+    std::cout << std::left << std::setw(64) << name << std::right << std::fixed << std::setprecision(2)
+        << " p50 " << std::setw(9) << result.percentile(0.5) << " ns  p90 " << std::setw(9) << result.percentile(0.9)
+        << " ns  p99 " << std::setw(9) << result.percentile(0.99) << " ns" << std::endl;
+
+    results.push_back(std::move(result));
+  }
+
+  template<typename ContainerT>
+  ContainerT filledContainer(const std::vector<std::ranges::range_value_t<ContainerT>> &values) {
+    ContainerT container{};
+
+    for (const auto &value: values)
+      ContainerTraits<ContainerT>::push(container, value);
+
+    return container;
+  }
+
+  template<typename ContainerT>
+  std::string concatenate(const ContainerT &container) {
+    if constexpr (requires { container.concat(); }) {
+      return container.concat();
+    } else {
+      std::ostringstream stream{};
+
+      for (auto iterator = container.begin(); iterator != container.end(); ++iterator) {
+        if (iterator != container.begin())
+          stream << ", ";
+
+        stream << *iterator;
+      }
+
+      return stream.str();
+    }
+  }
+
+  template<SortType Sort, typename ContainerT>
+  void benchmarkChunkedListSort(const std::vector<std::ranges::range_value_t<ContainerT>> &values) {
+    using T = std::ranges::range_value_t<ContainerT>;
+
+    constexpr bool quadratic = Sort == BubbleSort || Sort == SelectionSort || Sort == InsertionSort;
+
+    if constexpr (Sort == RadixSort && !chunked_list_utility::radix_sortable<std::less<T>, T>) {
+      return;
+    } else {
+      if (quadratic && values.size() > 10'000)
+        return;
+
+      static constexpr std::array<std::string_view, 8> sortNames{
+        "sort/BubbleSort", "sort/SelectionSort", "sort/InsertionSort", "sort/QuickSort", "sort/HeapSort",
+        "sort/MergeSort", "sort/IntroSort", "sort/RadixSort"
+      };
+
+      measure<ContainerT>(sortNames[Sort], values.size(), [&] { return filledContainer<ContainerT>(values); },
+                          [](ContainerT &container) { container.template sort<std::less<T>, Sort>(); });
+    }
+  }
+
+  template<typename ContainerT>
+  void benchmarkContainer(const std::vector<std::ranges::range_value_t<ContainerT>> &values) {
+    using Traits = ContainerTraits<ContainerT>;
+    using T = std::ranges::range_value_t<ContainerT>;
+
+    const size_t size = values.size();
+
+    measure<ContainerT>("push", size, [] { return ContainerT{}; }, [&values](ContainerT &container) {
+      for (const T &value: values)
+        Traits::push(container, value);
+    });
+
+    measure<ContainerT>("emplace", size, [] { return ContainerT{}; }, [size](ContainerT &container) {
+      for (size_t i = 0; i < size; ++i) {
+        if constexpr (std::is_same_v<T, std::string>)
+          Traits::emplace(container, 24, 'x');
+        else if constexpr (std::is_same_v<T, Padded64>)
+          Traits::emplace(container, uint64_t{i});
+        else
+          Traits::emplace(container, static_cast<T>(i));
+      }
+    });
+
+    measure<ContainerT>("pop", size, [&values] { return filledContainer<ContainerT>(values); },
+                        [size](ContainerT &container) {
+                          for (size_t i = 0; i < size; ++i)
+                            Traits::pop(container);
+                        });
+
+    const ContainerT filled = filledContainer<ContainerT>(values);
+
+    measure<ContainerT>("iterate", size, [] { return uint64_t{0}; }, [&filled](uint64_t &sum) {
+      for (const T &value: filled)
+        sum += digest(value);
+    });
+
+    if constexpr (Traits::indexable) {
+      measure<ContainerT>("index", size, [] { return uint64_t{0}; }, [&filled, size](uint64_t &sum) {
+        for (size_t i = 0; i < size; ++i)
+          sum += digest(filled[i]);
+      });
+    }
+
+    if constexpr (Traits::chunkSize) {
+      benchmarkChunkedListSort<BubbleSort, ContainerT>(values);
+      benchmarkChunkedListSort<SelectionSort, ContainerT>(values);
+      benchmarkChunkedListSort<InsertionSort, ContainerT>(values);
+      benchmarkChunkedListSort<QuickSort, ContainerT>(values);
+      benchmarkChunkedListSort<HeapSort, ContainerT>(values);
+      benchmarkChunkedListSort<MergeSort, ContainerT>(values);
+      benchmarkChunkedListSort<IntroSort, ContainerT>(values);
+      benchmarkChunkedListSort<RadixSort, ContainerT>(values);
+    } else {
+      measure<ContainerT>("sort", size, [&values] { return filledContainer<ContainerT>(values); },
+                          [](ContainerT &container) {
+                            if constexpr (std::is_same_v<ContainerT, std::list<T> >)
+                              container.sort();
+                            else
+                              std::sort(container.begin(), container.end());
+                          });
+    }
+
+    const ContainerT copy = filled;
+
+    measure<ContainerT>("equal", size, [] { return false; }, [&filled, &copy](bool &equal) {
+      equal = filled == copy;
+    });
+
+    measure<ContainerT>("concat", size, [] { return size_t{0}; }, [&filled](size_t &length) {
+      length = concatenate(filled).size();
+    });
+  }
+
+  template<typename T>
+  void benchmarkElement(const size_t size) {
+    std::mt19937_64 engine{42};
+    std::vector<T> values{};
+    values.reserve(size);
+
+    for (size_t i = 0; i < size; ++i)
+      values.push_back(makeValue<T>(engine));
+
+    benchmarkContainer<ChunkedList<T, 16> >(values);
+    benchmarkContainer<ChunkedList<T, 64> >(values);
+    benchmarkContainer<ChunkedList<T, 512> >(values);
+    benchmarkContainer<SlabChunkedList<T, 16> >(values);
+    benchmarkContainer<SlabChunkedList<T, 64> >(values);
+    benchmarkContainer<SlabChunkedList<T, 512> >(values);
+    benchmarkContainer<std::vector<T> >(values);
+    benchmarkContainer<std::deque<T> >(values);
+    benchmarkContainer<std::list<T> >(values);
+  }
+
+  /**
+   * @brief Measures ChunkedLists of ints with prefetching turned off, which only differ from ChunkedList<int> once the
+   * ChunkedList is larger than the last level cache
+   */
+  void benchmarkUnprefetched(const size_t size) {
+    std::mt19937_64 engine{42};
+    std::vector<UnprefetchedInt> values{};
+    values.reserve(size);
+
+    for (size_t i = 0; i < size; ++i)
+      values.push_back(makeValue<int>(engine));
+
+    benchmarkContainer<ChunkedList<UnprefetchedInt, 16> >(values);
+    benchmarkContainer<ChunkedList<UnprefetchedInt, 64> >(values);
+    benchmarkContainer<ChunkedList<UnprefetchedInt, 512> >(values);
+  }
+
+  void writeJson(std::ostream &os) {
+    os << "{\n  \"repetitions\": " << options.repetitions << ",\n  \"warmup\": " << options.warmup
+        << ",\n  \"unit\": \"ns per element\",\n  \"benchmarks\": [";
+
+    for (size_t index = 0; index < results.size(); ++index) {
+      const Result &result = results[index];
+
+      os << (index ? ",\n" : "\n") << "    {\"name\": \"" << result.name << "\", \"container\": \"" << result.container
+          << "\", \"element\": \"" << result.element << "\", \"chunk_size\": " << result.chunkSize
+          << ", \"operation\": \"" << result.operation << "\", \"size\": " << result.size << ", \"min\": "
+          << result.samples.front() << ", \"p50\": " << result.percentile(0.5) << ", \"p90\": "
+          << result.percentile(0.9) << ", \"p99\": " << result.percentile(0.99) << ", \"max\": "
+          << result.samples.back() << "}";
+    }
+
+    os << "\n  ]\n}\n";
+  }
+
+  size_t parseSize(const char *text) {
+    // accepts sizes written like 1e6, as well as plain integers
+    return static_cast<size_t>(std::stod(text));
+  }
+
+  bool parseOptions(const int argc, char **argv) {
+    for (int index = 1; index < argc; ++index) {
+      const std::string_view option = argv[index];
+
+      if (index + 1 == argc) {
+        std::cerr << "Missing value for " << option << '\n';
+        return false;
+      }
+
+      const char *value = argv[++index];
+
+      if (option == "--min-size") options.minSize = parseSize(value);
+      else if (option == "--max-size") options.maxSize = parseSize(value);
+      else if (option == "--repetitions") options.repetitions = std::max<size_t>(parseSize(value), 1);
+      else if (option == "--warmup") options.warmup = parseSize(value);
+      else if (option == "--filter") options.filter = value;
+      else if (option == "--json") options.jsonPath = value;
+      else if (option == "--numa") {
+        const std::string_view policy = value;
+
+        if (policy == "default") options.numaPolicy = DefaultNode;
+        else if (policy == "local") options.numaPolicy = LocalNode;
+        else if (policy == "interleave") options.numaPolicy = InterleaveNodes;
+        else {
+          options.numaPolicy = BindNode;
+          options.numaNode = static_cast<int>(parseSize(value));
+        }
+      }
+      else {
+        std::cerr << "Unknown option " << option << '\n';
+        return false;
+      }
+    }
+
+    return options.minSize > 0 && options.minSize <= options.maxSize;
+  }
+}
+
+int main(const int argc, char **argv) {
+  if (!parseOptions(argc, argv)) {
+    std::cerr << "Usage: ChunkedListBench [--min-size N] [--max-size N] [--repetitions N] [--warmup N] "
+        "[--filter TEXT] [--json PATH] [--numa POLICY]\n";
+    return EXIT_FAILURE;
+  }
+
+  for (size_t size = options.minSize; size <= options.maxSize; size *= 10) {
+    benchmarkElement<int>(size);
+    benchmarkUnprefetched(size);
+    benchmarkElement<Padded64>(size);
+    benchmarkElement<std::string>(size);
+  }
+
+  if (!options.jsonPath.empty()) {
+    std::ofstream file{options.jsonPath};
+    writeJson(file);
+
+    if (!file) {
+      std::cerr << "Failed to write " << options.jsonPath << '\n';
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -59,6 +59,15 @@ int main() {
 
     testData.setSource("Heap Sorting");
     Sorting<HeapSort, chunked_list>();
+
+    testData.setSource("Merge Sorting");
+    Sorting<MergeSort, chunked_list>();
+
+    testData.setSource("Intro Sorting");
+    Sorting<IntroSort, chunked_list>();
+
+    testData.setSource("Radix Sorting");
+    Sorting<RadixSort, chunked_list>();
   });
 
   callFunction("Iterators", [] {
@@ -129,5 +138,311 @@ int main() {
     ConcatenationAndIndexing<chunked_list, 5>();
   });
 
+  callFunction("Chunk recycling", [] {
+    testData.setSource("Test 1");
+    ChunkRecycling<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    ChunkRecycling<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    ChunkRecycling<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    ChunkRecycling<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    ChunkRecycling<chunked_list, 5>();
+  });
+
+  callFunction("In-place construction", [] {
+    testData.setSource("Test 1");
+    InPlaceConstruction<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    InPlaceConstruction<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    InPlaceConstruction<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    InPlaceConstruction<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    InPlaceConstruction<chunked_list, 5>();
+  });
+
+  callFunction("Random access", [] {
+    testData.setSource("Test 1");
+    RandomAccess<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    RandomAccess<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    RandomAccess<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    RandomAccess<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    RandomAccess<chunked_list, 5>();
+  });
+
+  callFunction("Bulk operations", [] {
+    testData.setSource("Test 1");
+    BulkOperations<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    BulkOperations<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    BulkOperations<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    BulkOperations<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    BulkOperations<chunked_list, 5>();
+  });
+
+  callFunction("Copying, moving and splicing", [] {
+    testData.setSource("Test 1");
+    CopyingMovingAndSplicing<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    CopyingMovingAndSplicing<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    CopyingMovingAndSplicing<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    CopyingMovingAndSplicing<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    CopyingMovingAndSplicing<chunked_list, 5>();
+  });
+
+  callFunction("Insertion and erasure", [] {
+    testData.setSource("Test 1");
+    InsertionAndErasure<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    InsertionAndErasure<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    InsertionAndErasure<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    InsertionAndErasure<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    InsertionAndErasure<chunked_list, 5>();
+  });
+
+  callFunction("Segmented iteration", [] {
+    testData.setSource("Test 1");
+    SegmentedIteration<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    SegmentedIteration<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    SegmentedIteration<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    SegmentedIteration<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    SegmentedIteration<chunked_list, 5>();
+  });
+
+  callFunction("Concurrent appending", [] {
+    testData.setSource("Test 1");
+    ConcurrentAppending<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    ConcurrentAppending<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    ConcurrentAppending<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    ConcurrentAppending<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    ConcurrentAppending<chunked_list, 5>();
+  });
+
+  callFunction("Queue mode", [] {
+    testData.setSource("Test 1");
+    QueueMode<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    QueueMode<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    QueueMode<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    QueueMode<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    QueueMode<chunked_list, 5>();
+  });
+
+  callFunction("Double-ended pushing", [] {
+    testData.setSource("Test 1");
+    DoubleEndedPushing<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    DoubleEndedPushing<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    DoubleEndedPushing<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    DoubleEndedPushing<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    DoubleEndedPushing<chunked_list, 5>();
+  });
+
+  callFunction("Snapshot saving", [] {
+    testData.setSource("Test 1");
+    SnapshotSaving<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    SnapshotSaving<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    SnapshotSaving<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    SnapshotSaving<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    SnapshotSaving<chunked_list, 5>();
+  });
+
+  callFunction("Formatting", [] {
+    testData.setSource("Test 1");
+    Formatting<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    Formatting<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    Formatting<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    Formatting<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    Formatting<chunked_list, 5>();
+  });
+
+  callFunction("Memory statistics", [] {
+    testData.setSource("Test 1");
+    MemoryStatistics<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    MemoryStatistics<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    MemoryStatistics<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    MemoryStatistics<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    MemoryStatistics<chunked_list, 5>();
+  });
+
+  callFunction("Automatic Chunk sizes", [] {
+    testData.setSource("Test 1");
+    AutomaticChunkSizes<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    AutomaticChunkSizes<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    AutomaticChunkSizes<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    AutomaticChunkSizes<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    AutomaticChunkSizes<chunked_list, 5>();
+  });
+
+  callFunction("Bulk erasure", [] {
+    testData.setSource("Test 1");
+    BulkErasure<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    BulkErasure<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    BulkErasure<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    BulkErasure<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    BulkErasure<chunked_list, 5>();
+  });
+
+  callFunction("Slab allocation", [] {
+    testData.setSource("Test 1");
+    SlabAllocation<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    SlabAllocation<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    SlabAllocation<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    SlabAllocation<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    SlabAllocation<chunked_list, 5>();
+  });
+
+  callFunction("Copy-on-write snapshots", [] {
+    testData.setSource("Test 1");
+    Snapshots<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    Snapshots<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    Snapshots<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    Snapshots<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    Snapshots<chunked_list, 5>();
+  });
+
+  callFunction("Single-writer reading", [] {
+    testData.setSource("Test 1");
+    SingleWriterReading<chunked_list, 1>();
+
+    testData.setSource("Test 2");
+    SingleWriterReading<chunked_list, 2>();
+
+    testData.setSource("Test 3");
+    SingleWriterReading<chunked_list, 3>();
+
+    testData.setSource("Test 4");
+    SingleWriterReading<chunked_list, 4>();
+
+    testData.setSource("Test 5");
+    SingleWriterReading<chunked_list, 5>();
+  });
+
   SUCCESS
 }
@@ -58,6 +58,15 @@ int main() {
 
     testData.setSource("Heap Sorting");
     Sorting<HeapSort, ChunkedList>();
+
+    testData.setSource("Merge Sorting");
+    Sorting<MergeSort, ChunkedList>();
+
+    testData.setSource("Intro Sorting");
+    Sorting<IntroSort, ChunkedList>();
+
+    testData.setSource("Radix Sorting");
+    Sorting<RadixSort, ChunkedList>();
   });
 
   callFunction("Iterators", [] {
@@ -128,5 +137,362 @@ int main() {
     ConcatenationAndIndexing<ChunkedList, 5>();
   });
 
+  callFunction("Chunk recycling", [] {
+    testData.setSource("Test 1");
+    ChunkRecycling<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    ChunkRecycling<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    ChunkRecycling<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    ChunkRecycling<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    ChunkRecycling<ChunkedList, 5>();
+  });
+
+  callFunction("In-place construction", [] {
+    testData.setSource("Test 1");
+    InPlaceConstruction<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    InPlaceConstruction<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    InPlaceConstruction<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    InPlaceConstruction<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    InPlaceConstruction<ChunkedList, 5>();
+  });
+
+  callFunction("Random access", [] {
+    testData.setSource("Test 1");
+    RandomAccess<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    RandomAccess<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    RandomAccess<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    RandomAccess<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    RandomAccess<ChunkedList, 5>();
+  });
+
+  callFunction("Bulk operations", [] {
+    testData.setSource("Test 1");
+    BulkOperations<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    BulkOperations<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    BulkOperations<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    BulkOperations<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    BulkOperations<ChunkedList, 5>();
+  });
+
+  callFunction("Copying, moving and splicing", [] {
+    testData.setSource("Test 1");
+    CopyingMovingAndSplicing<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    CopyingMovingAndSplicing<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    CopyingMovingAndSplicing<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    CopyingMovingAndSplicing<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    CopyingMovingAndSplicing<ChunkedList, 5>();
+  });
+
+  callFunction("Insertion and erasure", [] {
+    testData.setSource("Test 1");
+    InsertionAndErasure<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    InsertionAndErasure<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    InsertionAndErasure<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    InsertionAndErasure<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    InsertionAndErasure<ChunkedList, 5>();
+  });
+
+  callFunction("Parallel algorithms", [] {
+    testData.setSource("Test 1");
+    ParallelAlgorithms<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    ParallelAlgorithms<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    ParallelAlgorithms<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    ParallelAlgorithms<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    ParallelAlgorithms<ChunkedList, 5>();
+  });
+
+  callFunction("SIMD kernels", [] {
+    testData.setSource("Test 1");
+    SimdKernels<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    SimdKernels<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    SimdKernels<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    SimdKernels<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    SimdKernels<ChunkedList, 5>();
+  });
+
+  callFunction("Segmented iteration", [] {
+    testData.setSource("Test 1");
+    SegmentedIteration<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    SegmentedIteration<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    SegmentedIteration<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    SegmentedIteration<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    SegmentedIteration<ChunkedList, 5>();
+  });
+
+  callFunction("Concurrent appending", [] {
+    testData.setSource("Test 1");
+    ConcurrentAppending<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    ConcurrentAppending<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    ConcurrentAppending<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    ConcurrentAppending<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    ConcurrentAppending<ChunkedList, 5>();
+  });
+
+  callFunction("Queue mode", [] {
+    testData.setSource("Test 1");
+    QueueMode<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    QueueMode<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    QueueMode<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    QueueMode<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    QueueMode<ChunkedList, 5>();
+  });
+
+  callFunction("Double-ended pushing", [] {
+    testData.setSource("Test 1");
+    DoubleEndedPushing<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    DoubleEndedPushing<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    DoubleEndedPushing<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    DoubleEndedPushing<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    DoubleEndedPushing<ChunkedList, 5>();
+  });
+
+  callFunction("Snapshot saving", [] {
+    testData.setSource("Test 1");
+    SnapshotSaving<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    SnapshotSaving<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    SnapshotSaving<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    SnapshotSaving<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    SnapshotSaving<ChunkedList, 5>();
+  });
+
+  callFunction("Formatting", [] {
+    testData.setSource("Test 1");
+    Formatting<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    Formatting<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    Formatting<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    Formatting<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    Formatting<ChunkedList, 5>();
+  });
+
+  callFunction("Memory statistics", [] {
+    testData.setSource("Test 1");
+    MemoryStatistics<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    MemoryStatistics<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    MemoryStatistics<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    MemoryStatistics<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    MemoryStatistics<ChunkedList, 5>();
+  });
+
+  callFunction("Automatic Chunk sizes", [] {
+    testData.setSource("Test 1");
+    AutomaticChunkSizes<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    AutomaticChunkSizes<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    AutomaticChunkSizes<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    AutomaticChunkSizes<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    AutomaticChunkSizes<ChunkedList, 5>();
+  });
+
+  callFunction("Structure of arrays", [] {
+    testData.setSource("Test 1");
+    StructureOfArrays<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    StructureOfArrays<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    StructureOfArrays<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    StructureOfArrays<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    StructureOfArrays<ChunkedList, 5>();
+  });
+
+  callFunction("Bulk erasure", [] {
+    testData.setSource("Test 1");
+    BulkErasure<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    BulkErasure<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    BulkErasure<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    BulkErasure<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    BulkErasure<ChunkedList, 5>();
+  });
+
+  callFunction("Slab allocation", [] {
+    testData.setSource("Test 1");
+    SlabAllocation<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    SlabAllocation<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    SlabAllocation<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    SlabAllocation<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    SlabAllocation<ChunkedList, 5>();
+  });
+
+  callFunction("Copy-on-write snapshots", [] {
+    testData.setSource("Test 1");
+    Snapshots<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    Snapshots<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    Snapshots<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    Snapshots<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    Snapshots<ChunkedList, 5>();
+  });
+
+  callFunction("Single-writer reading", [] {
+    testData.setSource("Test 1");
+    SingleWriterReading<ChunkedList, 1>();
+
+    testData.setSource("Test 2");
+    SingleWriterReading<ChunkedList, 2>();
+
+    testData.setSource("Test 3");
+    SingleWriterReading<ChunkedList, 3>();
+
+    testData.setSource("Test 4");
+    SingleWriterReading<ChunkedList, 4>();
+
+    testData.setSource("Test 5");
+    SingleWriterReading<ChunkedList, 5>();
+  });
+
   SUCCESS
 }
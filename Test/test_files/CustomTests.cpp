@@ -1,6 +1,8 @@
 #include "../core/TestUtility.hpp"
 
 #include <chrono>
+#include <cstdint>
+#include <random>
 #include <ranges>
 #include <numeric>
 #include <vector>
@@ -8,6 +10,57 @@
 
 using namespace TestUtility;
 
+template<typename PushFunction>
+double concurrentPushTime(const size_t producers, const size_t pushesPerProducer, PushFunction push) {
+  std::vector<std::thread> threads{};
+  std::atomic<bool> started{false};
+
+  for (size_t producer = 0; producer < producers; ++producer) {
+    threads.emplace_back([&, producer] {
+      while (!started.load()) {
+      }
+
+      for (size_t i = 0; i < pushesPerProducer; ++i)
+        push(producer * pushesPerProducer + i);
+    });
+  }
+
+  const auto start = std::chrono::high_resolution_clock::now();
+  started = true;
+
+  for (std::thread &thread: threads)
+    thread.join();
+
+  const auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::duration<double> >(end - start).count();
+}
+
+template<typename T, SortType Sort>
+void sortTimeTest(const size_t elements) {
+  ChunkedList<T, 32> testList;
+  std::mt19937_64 engine{42};
+
+  for (size_t i = 0; i < elements; i++) {
+    if constexpr (std::is_floating_point_v<T>)
+      testList.push(std::uniform_real_distribution<T>{-1e9, 1e9}(engine));
+    else
+      testList.push(static_cast<T>(engine()));
+  }
+
+  std::cout << "starting..." << std::endl;
+
+  const auto start = std::chrono::high_resolution_clock::now();
+
+  testList.template sort<std::less<T>, Sort>();
+
+  const auto end = std::chrono::high_resolution_clock::now();
+  const auto duration_s = std::chrono::duration_cast<std::chrono::duration<double> >(end - start);
+  const auto duration_ns = std::chrono::duration_cast<std::chrono::duration<double, std::nano> >(end - start);
+
+  std::cout << "Total time taken to sort " << elements << " elements: " << duration_s.count() << " seconds\n";
+  std::cout << "Average time per element: " << duration_ns.count() / elements << " nanoseconds" << std::endl;
+}
+
 int main() {
   constexpr size_t pushes = 1000;
 
@@ -70,5 +123,117 @@ int main() {
     std::cout << "Average time to push 1 integer: " << duration_ns.count() / pushes << " nanoseconds" << std::endl;
   });
 
+  constexpr size_t sortedElements = 1'000'000;
+
+  callFunction("ChunkedList<uint32_t> QuickSort time test", [] {
+    sortTimeTest<uint32_t, QuickSort>(sortedElements);
+  });
+
+  callFunction("ChunkedList<uint32_t> RadixSort time test", [] {
+    sortTimeTest<uint32_t, RadixSort>(sortedElements);
+  });
+
+  callFunction("ChunkedList<uint64_t> QuickSort time test", [] {
+    sortTimeTest<uint64_t, QuickSort>(sortedElements);
+  });
+
+  callFunction("ChunkedList<uint64_t> RadixSort time test", [] {
+    sortTimeTest<uint64_t, RadixSort>(sortedElements);
+  });
+
+  callFunction("ChunkedList<double> QuickSort time test", [] {
+    sortTimeTest<double, QuickSort>(sortedElements);
+  });
+
+  callFunction("ChunkedList<double> RadixSort time test", [] {
+    sortTimeTest<double, RadixSort>(sortedElements);
+  });
+
+  callFunction("ChunkedList<int> parallel reduce scaling test", [] {
+    constexpr size_t elements = 10'000'000;
+
+    ChunkedList<int, 1024> testList;
+
+    for (size_t i = 0; i < elements; i++) {
+      testList.push(static_cast<int>(i % 1000));
+    }
+
+    std::cout << "starting..." << std::endl;
+
+    for (size_t threads = 1; threads <= std::max(std::thread::hardware_concurrency(), 1u); threads *= 2) {
+      chunked_list_utility::parallel::thread_pool pool{threads - 1};
+
+      const auto start = std::chrono::high_resolution_clock::now();
+
+      const long long sum = chunked_list_utility::parallel::reduce(testList, 0LL, std::plus<>{}, pool);
+
+      const auto end = std::chrono::high_resolution_clock::now();
+      const auto duration_s = std::chrono::duration_cast<std::chrono::duration<double> >(end - start);
+
+      std::cout << "Time taken to reduce " << elements << " integers to " << sum << " with " << pool.concurrency()
+          << " threads: " << duration_s.count() << " seconds\n";
+    }
+  });
+
+  callFunction("ChunkedList<int> SIMD kernel time test", [] {
+    namespace simd = chunked_list_utility::simd;
+    constexpr size_t elements = 10'000'000;
+
+    ChunkedList<int, 512> testList;
+
+    for (size_t i = 0; i < elements; i++) {
+      testList.push(static_cast<int>(i % 1000));
+    }
+
+    std::cout << "starting..." << std::endl;
+
+    for (const simd::InstructionSet instructionSet: {simd::Scalar, simd::SSE2, simd::AVX2}) {
+      if (instructionSet > simd::supported_instruction_set()) break;
+
+      simd::set_instruction_set(instructionSet);
+
+      const auto start = std::chrono::high_resolution_clock::now();
+
+      const size_t count = simd::count(testList, 7);
+      const long long sum = simd::sum(testList);
+      const auto [min, max] = simd::minmax(testList);
+
+      const auto end = std::chrono::high_resolution_clock::now();
+      const auto duration_s = std::chrono::duration_cast<std::chrono::duration<double> >(end - start);
+
+      std::cout << "Time taken to count (" << count << "), sum (" << sum << ") and find the minimum and maximum ("
+          << min << ", " << max << ") of " << elements << " integers with instruction set " << instructionSet << ": "
+          << duration_s.count() << " seconds\n";
+    }
+
+    simd::set_instruction_set(simd::supported_instruction_set());
+  });
+
+  callFunction("ConcurrentChunkedList<size_t> push throughput test", [] {
+    constexpr size_t pushes = 4'000'000;
+
+    std::cout << "starting..." << std::endl;
+
+    for (const size_t producers: {1, 4, 16, 32}) {
+      const size_t pushesPerProducer = pushes / producers;
+
+      ConcurrentChunkedList<size_t, 512> concurrentList;
+      const double concurrentTime = concurrentPushTime(producers, pushesPerProducer, [&](const size_t value) {
+        concurrentList.push(value);
+      });
+
+      ChunkedList<size_t, 512> lockedList;
+      std::mutex mutex;
+      const double lockedTime = concurrentPushTime(producers, pushesPerProducer, [&](const size_t value) {
+        std::lock_guard lock{mutex};
+        lockedList.push(value);
+      });
+
+      std::cout << producers << " producers: " << pushes / concurrentTime / 1e6
+          << " million pushes per second to a ConcurrentChunkedList, " << pushes / lockedTime / 1e6
+          << " million pushes per second to a mutex-wrapped ChunkedList\n";
+    }
+  });
+
   return 0;
 }
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "ChunkedList.hpp"
+
+/**
+ * @class ChunkSlab
+ * @brief An allocator of fixed-size blocks carved out of 2MB slabs, which a ChunkedList can allocate its Chunks from
+ * instead of allocating each Chunk separately.
+ *
+ * On Linux each slab is mapped with mmap at a 2MB boundary and advised to be backed by a transparent huge page, so a
+ * long ChunkedList spans a few TLB entries instead of one per 4K page, and the slab's memory can be bound to NUMA nodes
+ * with mbind before it is first touched. Elsewhere the slabs are allocated with an aligned operator new, and the NUMA
+ * policy is ignored.
+ *
+ * Freed blocks are kept for reuse, and the slabs are only released when the ChunkSlab is destroyed, which must happen
+ * after every block has been freed. Allocating and freeing are guarded by a mutex, so a ChunkSlab can be shared by
+ * ChunkedLists on different threads.
+ */
+class ChunkSlab {
+  /**
+   * @brief A freed block, linked to the next freed block through its own storage
+   */
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  size_t blockSize;
+
+  size_t blockAlignment;
+
+  chunked_list_utility::NumaPolicy numaPolicy;
+
+  int numaNode;
+
+  std::vector<void *> slabs{};
+
+  /**
+   * @brief The next block of the newest slab which has never been allocated, and the end of that slab
+   */
+  std::byte *unusedBlock{nullptr};
+  std::byte *unusedEnd{nullptr};
+
+  FreeBlock *freeBlocks{nullptr};
+
+  size_t blockCount{0};
+
+  mutable std::mutex mutex{};
+
+  /**
+   * @brief Allocates a slab, advising huge pages and applying the NUMA policy where the platform supports them
+   * @throws std::system_error If the slab can't be mapped, or the NUMA policy can't be applied to it
+   */
+  void *allocateSlab() const;
+
+  static void deallocateSlab(void *slab) noexcept;
+
+  public:
+    /**
+     * @brief The size of each slab, which is the size of a huge page on x86-64 and most AArch64 systems
+     */
+    static constexpr size_t slabSize = size_t{2} << 20;
+
+    /**
+     * @brief Creates a ChunkSlab for blocks of the given size and alignment, allocating no slab until the first block
+     * @param blockSize The size of each block, which is rounded up to a multiple of the alignment
+     * @param blockAlignment The alignment of each block, which must be a power of 2 of at most 4096
+     * @param numaPolicy Which NUMA nodes the slabs are placed on
+     * @param numaNode The node which the slabs are bound to, if the policy is BindNode
+     * @throws std::invalid_argument If the alignment or the node is invalid, or a block doesn't fit into a slab
+     */
+    ChunkSlab(size_t blockSize, size_t blockAlignment,
+              chunked_list_utility::NumaPolicy numaPolicy = chunked_list_utility::DefaultNode, int numaNode = 0);
+
+    ChunkSlab(const ChunkSlab &) = delete;
+
+    ChunkSlab &operator=(const ChunkSlab &) = delete;
+
+    /**
+     * @brief Releases every slab, so no block may be in use
+     */
+    ~ChunkSlab();
+
+    /**
+     * @brief Returns uninitialised storage for a block, reusing a freed block before carving a new one
+     * @throws std::system_error If a new slab is needed and can't be allocated
+     */
+    void *allocate();
+
+    /**
+     * @brief Frees a block returned by allocate, keeping it for reuse
+     */
+    void deallocate(void *block) noexcept;
+
+    /**
+     * @brief Returns the size of each block, after rounding up to the alignment
+     */
+    size_t getBlockSize() const;
+
+    size_t getBlockAlignment() const;
+
+    chunked_list_utility::NumaPolicy getNumaPolicy() const;
+
+    /**
+     * @brief Returns the number of slabs allocated so far
+     */
+    size_t getSlabCount() const;
+
+    /**
+     * @brief Returns the number of blocks currently allocated
+     */
+    size_t getBlockCount() const;
+};
+
+#include "../src/ChunkSlab.tpp"
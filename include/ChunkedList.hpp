@@ -1,12 +1,41 @@
 #pragma once
 
 #include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <charconv>
 #include <initializer_list>
 #include <cstring>
+#include <cstddef>
+#include <filesystem>
 #include <functional>
+#include <compare>
+#include <concepts>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <version>
+
+#ifdef __cpp_lib_format
+#include <format>
+#endif
 
 #include "internal/ChunkedListUtility.hpp"
 
+/**
+ * @brief Declared rather than included, so that only code attaching a ChunkSlab to a ChunkedList includes
+ * ChunkSlab.hpp and its platform headers
+ */
+class ChunkSlab;
+
 /**
  * @class ChunkedList
  * @brief A contiguous-like linear data structure, implemented as a linked list of fixed-size Chunks.
@@ -23,8 +52,46 @@ class ChunkedList {
 
     size_t chunkCount{1};
 
+    size_t elementCount{0};
+
     class Chunk {
-      T data[ChunkSize]{};
+      public:
+        /**
+         * @brief The index of the first constructed element, which is only above 0 in the front Chunk, once elements
+         * have been popped from the front
+         */
+        size_t startIndex{0};
+
+        size_t nextIndex{0};
+
+        /**
+         * @brief The position of the Chunk within the ChunkedList, counting up from the front Chunk while the chunk
+         * directory is dense. Chunks pushed to the front count down below the old front's position, wrapping around, so
+         * positions are only ever compared through their difference. Otherwise, the index of its ChunkIndex node
+         */
+        size_t position{0};
+
+        /**
+         * @brief The ChunkedList's snapshot epoch when the Chunk was allocated, copied, last reused or found to be
+         * unshared, so that it is shared with each live Snapshot taken at an epoch from this one onwards
+         */
+        size_t epoch{0};
+
+        Chunk *nextChunk{nullptr};
+        Chunk *prevChunk{nullptr};
+
+      private:
+        /**
+         * @brief Uninitialised storage for ChunkSize elements, of which only those from startIndex to nextIndex are
+         * constructed. It comes after the header, so that the indices and links which iteration reads are always on
+         * the Chunk's first cache line, whatever the size of the elements
+         */
+        alignas(chunked_list_utility::chunk_alignment<T>) std::byte data[sizeof(T) * ChunkSize];
+
+        /**
+         * @brief Returns the address of the storage for the element at the given index, whether constructed or not
+         */
+        T *slot(size_t index);
 
       public:
         Chunk(Chunk *nextChunk, Chunk *prevChunk);
@@ -35,7 +102,14 @@ class ChunkedList {
 
         Chunk() = default;
 
-        ~Chunk() = default;
+        Chunk(const Chunk &) = delete;
+
+        Chunk &operator=(const Chunk &) = delete;
+
+        /**
+         * @brief Destroys every constructed element in the Chunk
+         */
+        ~Chunk();
 
         /**
          * @brief returns the chunk x chunks ahead of the given chunk. Does not account for overflows
@@ -43,65 +117,828 @@ class ChunkedList {
         Chunk &operator+(size_t offset);
 
         /**
-         * @brief returns the chunk x chunks behind the given chunk. Does not account for overflows
+         * @brief returns the chunk x chunks behind the given chunk. Does not account for underflows
          */
         Chunk &operator-(size_t offset);
 
-        size_t nextIndex{0};
+        bool empty() const;
 
-        Chunk *nextChunk{nullptr};
-        Chunk *prevChunk{nullptr};
+        /**
+         * @brief Returns the number of constructed elements in the Chunk
+         */
+        size_t size() const;
 
-        bool empty() const;
+        /**
+         * @brief Constructs an element in place at the next index
+         * @return A reference to the constructed element
+         */
+        template<typename... Args>
+        T &emplace(Args &&... args);
+
+        /**
+         * @brief Constructs an element in place just before the start index, which must be above 0
+         * @return A reference to the constructed element
+         */
+        template<typename... Args>
+        T &emplaceFront(Args &&... args);
+
+        /**
+         * @brief Copies the given number of elements to the end of the Chunk, using memcpy for contiguous trivially copyable elements
+         * @param first An iterator to the first element to copy
+         * @param count The number of elements to copy, which must fit in the Chunk
+         * @return The iterator advanced past the last copied element
+         */
+        template<typename InputIterator>
+        InputIterator append(InputIterator first, size_t count);
+
+        /**
+         * @brief Value-initialises the given number of elements at the end of the Chunk
+         */
+        void appendDefault(size_t count);
+
+        /**
+         * @brief Copy constructs the given number of copies of the value at the end of the Chunk
+         */
+        void appendCopies(size_t count, const T &value);
+
+        /**
+         * @brief Constructs an element in place at the given index, shifting the later elements back by one
+         * @return A reference to the constructed element
+         */
+        template<typename... Args>
+        T &insert(size_t index, Args &&... args);
+
+        /**
+         * @brief Destroys the given number of elements from the given index, shifting the later elements forwards
+         */
+        void erase(size_t index, size_t count);
+
+        /**
+         * @brief Moves every element from the given index onwards to the end of the destination Chunk
+         */
+        void moveElementsTo(Chunk &destination, size_t index);
+
+        /**
+         * @brief Destroys the element before the next index
+         */
+        void pop();
+
+        /**
+         * @brief Destroys the given number of elements from the start index onwards, without shifting the others
+         */
+        void popFront(size_t count);
+
+        /**
+         * @brief Moves the elements to the start of the Chunk's storage, so that the start index is 0
+         */
+        void compact();
+
+        /**
+         * @brief Destroys every constructed element in the Chunk
+         */
+        void clear();
 
         T &operator[](size_t index);
 
         const T &operator[](size_t index) const;
 
+        /**
+         * @brief Returns a span over the constructed elements of the Chunk
+         */
+        std::span<T> elements();
+
+        /**
+         * @brief Returns a span over the constructed elements of the Chunk
+         */
+        std::span<const T> elements() const;
+
         bool operator==(const Chunk &other) const;
 
         bool operator!=(const Chunk &other) const;
 
         void debugData(std::string &str) const;
+
+#ifdef CHUNKED_LIST_COUNTERS
+        /**
+         * @brief Allocates a Chunk, counting the allocation wherever the Chunk is created
+         */
+        static void *operator new(size_t size);
+
+        static void *operator new(size_t size, std::align_val_t alignment);
+
+        /**
+         * @brief Deallocates a Chunk, counting the deallocation wherever the Chunk is deleted
+         */
+        static void operator delete(void *pointer, size_t size);
+
+        static void operator delete(void *pointer, size_t size, std::align_val_t alignment);
+#endif
     };
 
+    static_assert(sizeof(Chunk) == chunked_list_utility::chunk_bytes<T>(ChunkSize),
+                  "The Chunk header has to match chunked_list_utility::chunk_header_size for auto_size to be accurate");
+
     /**
-     * @brief The first Chunk in the ChunkedList
+     * @brief The first Chunk in the ChunkedList, which is only null once a move has left the ChunkedList without any
+     * Chunk, as are backChunk and chunkCount
      */
-    Chunk *front{nullptr};
+    Chunk *frontChunk{nullptr};
 
     /**
      * @brief The most recent Chunk in the ChunkedList
      */
-    Chunk *back{nullptr};
+    Chunk *backChunk{nullptr};
+
+    /**
+     * @brief An order statistic tree over the Chunks, a treap kept in the order of the ChunkedList, which finds Chunks
+     * and elements in O(log n) while partially filled Chunks in the middle stop the chunk directory from being dense.
+     * Each node counts the slots of its Chunk up to the next index, counting from the start of its storage
+     */
+    class ChunkIndex {
+      struct Node {
+        Chunk *chunk;
+        size_t parent;
+        size_t left;
+        size_t right;
+
+        /**
+         * @brief The next index of the Chunk, or 0 for the back Chunk, whose next index changes with every push
+         */
+        size_t slots;
+
+        /**
+         * @brief The number of Chunks in the subtree rooted at the node
+         */
+        size_t subtreeChunks;
+
+        /**
+         * @brief The slots of every Chunk in the subtree rooted at the node
+         */
+        size_t subtreeSlots;
+
+        /**
+         * @brief The random priority, which is never lower than a child's, keeping the tree O(log n) deep on average
+         */
+        uint64_t priority;
+      };
+
+      /**
+       * @brief The nodes, of which unused ones are linked from freeNode through their parents, so that a node keeps
+       * its index for as long as its Chunk is in the tree
+       */
+      std::vector<Node> nodes{};
+
+      size_t root{none};
+      size_t freeNode{none};
+
+      /**
+       * @brief The state of the generator of node priorities
+       */
+      uint64_t seed{0};
+
+      /**
+       * @brief Takes an unused node for the given Chunk, with a new random priority
+       */
+      size_t allocateNode(Chunk *chunk, size_t slots);
+
+      /**
+       * @brief Recomputes the counts of the given node's subtree from its children
+       */
+      void pull(size_t node);
+
+      /**
+       * @brief Recomputes the counts of every node in the given subtree, from the bottom up
+       */
+      void pullSubtree(size_t node);
+
+      /**
+       * @brief Rotates the given node above its parent, keeping the order of the Chunks
+       */
+      void rotateUp(size_t node);
+
+      size_t leftmost(size_t node) const;
+
+      size_t rightmost(size_t node) const;
+
+      /**
+       * @brief Returns the number of Chunks in the given subtree, which is 0 for none
+       */
+      size_t countChunks(size_t node) const;
+
+      /**
+       * @brief Returns the slots of every Chunk in the given subtree, which is 0 for none
+       */
+      size_t countSlots(size_t node) const;
+
+      public:
+        /**
+         * @brief Marks a missing node, such as the parent of the root
+         */
+        static constexpr size_t none = std::numeric_limits<size_t>::max();
+
+        /**
+         * @brief Replaces the tree with one of the given Chunks in order, in O(count), giving every Chunk but the last
+         * its next index as its slots
+         * @return The index of the first node, after which the nodes of the other Chunks follow in order
+         */
+        size_t build(Chunk *const *chunks, size_t count);
+
+        void clear();
+
+        /**
+         * @brief Allocates nodes for the given number of Chunks, so that inserting up to that many doesn't throw
+         */
+        void reserve(size_t count);
+
+        /**
+         * @brief Inserts a node for the Chunk after the given node, or at the front if it is none
+         * @return The index of the new node
+         */
+        size_t insertAfter(size_t node, Chunk *chunk, size_t slots);
+
+        void erase(size_t node);
+
+        void setSlots(size_t node, size_t slots);
+
+        /**
+         * @brief Recounts the slots of every node from the next indices of their Chunks in O(n), without allocating
+         */
+        void recount();
+
+        /**
+         * @brief Returns the number of Chunks in the tree
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns the slots of every Chunk in the tree
+         */
+        size_t slots() const;
+
+        size_t first() const;
+
+        size_t last() const;
+
+        /**
+         * @brief Returns the node after the given one in order, or none after the last one
+         */
+        size_t next(size_t node) const;
+
+        /**
+         * @brief Returns the number of Chunks before the given node's
+         */
+        size_t rank(size_t node) const;
+
+        /**
+         * @brief Returns the slots of the Chunks before the given node's
+         */
+        size_t slotsBefore(size_t node) const;
+
+        /**
+         * @brief Returns the node of the Chunk with the given number of Chunks before it
+         */
+        size_t at(size_t rank) const;
+
+        /**
+         * @brief Finds the node whose slots include the given slot, which must be less than slots()
+         * @return The node, and the index of the slot within its Chunk
+         */
+        std::pair<size_t, size_t> locate(size_t slot) const;
+
+        Chunk *&chunk(size_t node);
+
+        Chunk *chunk(size_t node) const;
+
+        /**
+         * @brief Returns the number of bytes allocated for nodes
+         */
+        size_t allocatedBytes() const;
+    };
+
+    /**
+     * @brief The Chunks of the ChunkedList in order, allowing any Chunk to be found in O(1) from its position while
+     * every Chunk but the back one is full, and in O(log n) through a ChunkIndex otherwise
+     */
+    class ChunkDirectory {
+      /**
+       * @brief The entries, which may be shared with Snapshots of the ChunkedList. Snapshots only read the entries which
+       * were in use when they were taken, so entries can still be appended to a shared buffer in place
+       */
+      std::shared_ptr<Chunk *[]> chunks{};
+
+      /**
+       * @brief The number of unused entries at the start of chunks, left by Chunks popped from the front or reserved
+       * for Chunks pushed to the front, which keeps pushing and popping at the front amortised O(1)
+       */
+      size_t frontOffset{0};
+
+      /**
+       * @brief The index after the last entry in use
+       */
+      size_t backOffset{0};
+
+      size_t entryCapacity{0};
+
+      /**
+       * @brief The entries read by Snapshots, which are copied to a new buffer before any of them is overwritten
+       */
+      size_t sharedBegin{0};
+      size_t sharedEnd{0};
+
+      /**
+       * @brief Moves the entries in use to a new buffer of the given capacity, starting at the given front offset
+       */
+      void reallocate(size_t capacity, size_t offset);
+
+      /**
+       * @brief Moves the entries to a new buffer if any entry from the first index to before the last one is shared
+       */
+      void unshare(size_t first, size_t last);
+
+      /**
+       * @brief Writes the Chunks of the ChunkIndex in order to the start of the entries, moving them to a new buffer
+       * first if any are shared
+       */
+      void fillFromIndex(size_t count);
+
+      /**
+       * @brief The Chunks in order while the directory isn't dense, in which case the entries are left as they were
+       * and each Chunk's position is the index of its node
+       */
+      ChunkIndex chunkIndex{};
+
+      public:
+        ChunkDirectory() = default;
+
+        ChunkDirectory(ChunkDirectory &&other) noexcept;
+
+        ChunkDirectory &operator=(ChunkDirectory &&other) noexcept;
+
+        /**
+         * @brief Whether every Chunk but the back one is filled to the end of its storage, so that elements can be
+         * located in O(1) from their index. Positional insertion and erasure can leave partially filled Chunks in the
+         * middle, after which the Chunks are found through the ChunkIndex instead, in O(log n). Only changed by
+         * makeSparse and makeDense
+         */
+        bool dense{true};
+
+        /**
+         * @brief Builds the ChunkIndex from the entries in O(n), unless the directory is already sparse
+         */
+        void makeSparse();
+
+        /**
+         * @brief Rewrites the entries from the ChunkIndex in O(n), numbering the positions from 0, once every Chunk
+         * but the back one is full again. Only writing the entries can throw, which leaves the directory sparse
+         */
+        void makeDense();
+
+        /**
+         * @brief Recounts the slots of every Chunk in O(n) while the directory is sparse, after the next indices of
+         * many Chunks have changed without being updated one by one
+         */
+        void recount();
+
+        /**
+         * @brief Adds the Chunk linked after the given one, leaving the directory dense only if it is the new back
+         * Chunk after a full one
+         */
+        void insertAfter(Chunk *chunk, Chunk *newChunk);
+
+        /**
+         * @brief Removes the given Chunk before it is unlinked, making the directory sparse unless it is the front or
+         * back Chunk, and dense again once one Chunk is left
+         */
+        void erase(const Chunk *chunk);
+
+        /**
+         * @brief Records that the next index of the given Chunk has changed, making the directory sparse if it is
+         * partially filled and not the back Chunk
+         */
+        void update(const Chunk *chunk);
+
+        /**
+         * @brief Returns the entry of the given Chunk to be replaced, moving the entries to a new buffer first if it is
+         * shared with a Snapshot
+         */
+        Chunk *&entry(const Chunk *chunk);
+
+        /**
+         * @brief Returns the Chunk at the given Chunk's position, which differs from it once it has been replaced
+         */
+        Chunk *entry(const Chunk *chunk) const;
+
+        /**
+         * @brief Returns the number of Chunks before the given one
+         */
+        size_t indexOf(const Chunk *chunk) const;
+
+        /**
+         * @brief Returns the number of slots before the given Chunk's storage, counting from the start of the front
+         * Chunk's storage
+         */
+        size_t slotsBefore(const Chunk *chunk) const;
+
+        /**
+         * @brief Finds the Chunk holding the given slot, counting from the start of the front Chunk's storage
+         * @return The Chunk, and the index of the slot within it
+         */
+        std::pair<Chunk *, size_t> locate(size_t slot) const;
+
+        /**
+         * @brief Returns the entry at the given index of a dense directory to be overwritten, moving the entries to a
+         * new buffer first if it is shared with a Snapshot
+         */
+        Chunk *&operator[](size_t index);
+
+        Chunk *operator[](size_t index) const;
+
+        size_t size() const;
+
+        /**
+         * @brief Returns the number of bytes allocated for entries, including the unused entries at the start, and for
+         * the nodes of the ChunkIndex
+         */
+        size_t allocatedBytes() const;
+
+        Chunk *front() const;
+
+        Chunk *back() const;
+
+        /**
+         * @brief Adds the Chunk linked after the back one, giving it the next position
+         */
+        void push_back(Chunk *chunk);
+
+        void pop_back();
+
+        /**
+         * @brief Adds the Chunk linked before the front one, giving it the previous position
+         */
+        void push_front(Chunk *chunk);
+
+        void pop_front();
+
+        /**
+         * @brief Resizes the entries of a dense directory, leaving any new ones null
+         */
+        void resize(size_t size);
+
+        /**
+         * @brief Allocates entries for the given number of Chunks, and nodes too while the directory is sparse, so
+         * that adding up to that many Chunks doesn't throw unless an entry is shared
+         */
+        void reserve(size_t capacity);
+
+        /**
+         * @brief Marks the given number of entries from the front as read by a Snapshot, so they are never overwritten
+         * in place again. The entries of a sparse directory are first rewritten from the ChunkIndex, in O(n)
+         * @return The buffer, which the Snapshot keeps alive, and the first of the entries
+         */
+        std::pair<std::shared_ptr<Chunk *[]>, Chunk *const *> share(size_t count);
+
+        /**
+         * @brief Marks every entry as no longer read by any Snapshot, once every Snapshot sharing them has been destroyed
+         */
+        void releaseShared();
+    };
+
+    ChunkDirectory chunkDirectory{};
+
+#ifdef CHUNKED_LIST_COUNTERS
+    /**
+     * @brief The counters of every ChunkedList<T, ChunkSize>, which are shared so that iterators, which don't know
+     * their ChunkedList, can count too
+     */
+    struct CounterStorage {
+      std::atomic<size_t> chunkAllocations{0};
+      std::atomic<size_t> chunkDeallocations{0};
+      std::atomic<size_t> pushes{0};
+      std::atomic<size_t> pops{0};
+      std::atomic<size_t> chunkHops{0};
+    };
+
+    static inline CounterStorage counterStorage{};
+#endif
+
+    /**
+     * @brief Gives a ChunkedList left without any Chunk by a move its first Chunk, before elements are added to it
+     */
+    void ensureChunk();
 
     /**
      * @brief simply pushes a chunk to the back, without mutating the chunkCount
      */
     void pushChunk(Chunk *chunk);
 
+    /**
+     * @brief Links a Chunk before the front Chunk, without mutating the chunkCount
+     */
+    void pushFrontChunk(Chunk *chunk);
+
+    /**
+     * @brief Spare Chunks kept for reuse, singly linked through their nextChunk pointers
+     */
+    Chunk *spareChunks{nullptr};
+
+    size_t spareChunkCount{0};
+
+    RetentionPolicy retentionPolicy{KeepSpareChunks};
+
+    size_t retentionLimit{1};
+
+    /**
+     * @brief A ChunkSlab attached to ChunkedLists, along with its operations, which the constructor taking a ChunkSlab
+     * binds while ChunkSlab is complete. It is shared by copies of the ChunkedList and the Chunks their Snapshots keep,
+     * and counts them itself, so that a ChunkedList without a ChunkSlab only stores a null pointer
+     */
+    struct SlabAttachment {
+      std::shared_ptr<ChunkSlab> slab;
+
+      void *(*allocate)(ChunkSlab &slab);
+
+      void (*deallocate)(ChunkSlab &slab, void *block) noexcept;
+
+      std::atomic<size_t> references{1};
+    };
+
+    /**
+     * @brief The attachment of the ChunkSlab which every Chunk of the ChunkedList, spare ones included, is allocated
+     * from, or null if they are allocated with new
+     */
+    SlabAttachment *chunkSlab{nullptr};
+
+    /**
+     * @brief Counts another holder of the attachment, which may be null
+     * @return The attachment
+     */
+    static SlabAttachment *retainSlab(SlabAttachment *attachment) noexcept;
+
+    /**
+     * @brief Drops a holder of the attachment, which may be null, deleting it along with its reference to the ChunkSlab
+     * once the last holder drops it
+     */
+    static void releaseSlab(SlabAttachment *attachment) noexcept;
+
+    /**
+     * @brief Binds the operations of the ChunkSlab into a new attachment, which is null if the ChunkSlab is
+     * @throws std::invalid_argument If the ChunkSlab's blocks are too small or not aligned enough for a Chunk
+     */
+    template<std::same_as<ChunkSlab> Slab>
+    static SlabAttachment *attachSlab(std::shared_ptr<Slab> slab);
+
+    /**
+     * @brief Constructs an empty ChunkedList allocating its Chunks from the attachment, whose holder it becomes, or
+     * with new if the attachment is null
+     */
+    explicit ChunkedList(SlabAttachment *slab);
+
+    /**
+     * @brief Allocates and constructs a Chunk from the given arguments, from the ChunkSlab if there is one
+     */
+    template<typename... Args>
+    Chunk *allocateChunk(Args &&... args);
+
+    /**
+     * @brief Destroys and deallocates a Chunk, returning it to the ChunkSlab if there is one
+     */
+    void deallocateChunk(Chunk *chunk);
+
+    /**
+     * @brief Destroys and deallocates a Chunk, returning it to the ChunkSlab of the given attachment if it isn't null
+     */
+    static void deallocateChunk(Chunk *chunk, const SlabAttachment *slab);
+
+    /**
+     * @brief Returns an empty, unlinked Chunk, reusing a spare Chunk before allocating a new one
+     */
+    Chunk *acquireChunk();
+
+    /**
+     * @brief Keeps the given Chunk as a spare if the retention policy allows it, otherwise deallocates it
+     */
+    void releaseChunk(Chunk *chunk);
+
+    /**
+     * @brief Appends the given number of elements from an iterator, filling whole Chunks at once
+     */
+    template<typename InputIterator>
+    void appendCount(InputIterator first, size_t count);
+
+    /**
+     * @brief Pops elements from the back until the ChunkedList holds at most the given number of elements
+     */
+    void truncate(size_t size);
+
+    /**
+     * @brief Removes every element of the back Chunk, and the Chunk itself unless it is the only one, without counting
+     * them as pops
+     */
+    void removeBackChunk();
+
+    /**
+     * @brief Links a Chunk after the given Chunk and adds it to the chunk directory, without updating the slots of the
+     * given Chunk unless it was the back Chunk
+     */
+    void linkChunk(Chunk *chunk, Chunk *newChunk);
+
+    /**
+     * @brief Removes the given empty Chunk from the chunk directory, then unlinks and releases it
+     */
+    void unlinkChunk(Chunk *chunk);
+
+    /**
+     * @brief Unlinks and releases the front Chunk if every one of its elements has been popped, and it isn't the back
+     */
+    void releaseConsumedFront();
+
+    /**
+     * @brief Merges the given Chunk with a neighbour if it is under half full and their elements fit into one Chunk
+     * @return The Chunk which holds the given Chunk's elements afterwards, and the index of its first element
+     */
+    std::pair<Chunk *, size_t> mergeChunk(Chunk *chunk);
+
+    /**
+     * @brief Prefetches the Chunk chunked_list_utility::prefetch_policy<T>::distance Chunks after the given one, found
+     * in O(1) through the chunk directory while it is dense, or only the next Chunk otherwise. Always inlined like
+     * chunked_list_utility::prefetch
+     */
+    [[gnu::always_inline]] static void prefetchAhead(const Chunk *chunk, const ChunkDirectory *directory);
+
+    /**
+     * @brief A Chunk which the ChunkedList no longer uses, owned by the Snapshots still reading it, which deallocates it
+     * once the last of them is destroyed
+     */
+    struct SharedChunk {
+      Chunk *chunk{nullptr};
+
+      SlabAttachment *slab{nullptr};
+
+      SharedChunk() = default;
+
+      SharedChunk(const SharedChunk &) = delete;
+
+      SharedChunk &operator=(const SharedChunk &) = delete;
+
+      ~SharedChunk();
+    };
+
+    /**
+     * @brief Everything a Snapshot reads, shared by its copies: the chunk directory entries and Chunks it shares with
+     * the ChunkedList, its own copy of a partially filled back Chunk, and the shared Chunks which the ChunkedList has
+     * since replaced or released
+     */
+    struct SnapshotState {
+      /**
+       * @brief The number of Snapshots using the state, which the ChunkedList loads with acquire semantics, so that
+       * their reads happen before it modifies or deallocates a Chunk they shared
+       */
+      std::atomic<size_t> snapshotCount{1};
+
+      /**
+       * @brief The snapshot epoch of the ChunkedList when the Snapshot was taken
+       */
+      size_t epoch{0};
+
+      std::shared_ptr<Chunk *[]> directory{};
+
+      /**
+       * @brief The directory entries of the shared Chunks, from the front Chunk onwards
+       */
+      Chunk *const *sharedChunks{nullptr};
+
+      size_t sharedChunkCount{0};
+
+      std::shared_ptr<SharedChunk> backChunk{};
+
+      std::vector<std::shared_ptr<SharedChunk> > releasedChunks{};
+
+      size_t elementCount{0};
+
+      bool dense{true};
+
+      /**
+       * @brief The slot after the last element of each Chunk, counting from the start of the front Chunk's storage,
+       * which elements are found in by binary search unless the chunk directory was dense
+       */
+      std::vector<size_t> chunkEnds{};
+
+      /**
+       * @brief Returns the number of Chunks in the Snapshot, counting the copied back Chunk
+       */
+      size_t chunkCount() const;
+
+      /**
+       * @brief Returns the Chunk at the given index, where the copied back Chunk follows the shared ones
+       */
+      const Chunk *chunk(size_t index) const;
+
+      /**
+       * @brief Returns whether any Snapshot still uses the state
+       */
+      bool alive() const;
+    };
+
+    /**
+     * @brief The states of the Snapshots taken of the ChunkedList which may still be alive, oldest first
+     */
+    std::vector<std::shared_ptr<SnapshotState> > snapshotStates{};
+
+    /**
+     * @brief Whether any Chunk may be shared with a Snapshot, which every modification of an existing Chunk checks
+     * before looking through the Snapshots
+     */
+    bool sharingChunks{false};
+
+    /**
+     * @brief The number of Snapshots taken, which Chunks are stamped with as their epoch
+     */
+    size_t snapshotEpoch{0};
+
+    /**
+     * @brief Removes the states of Snapshots which have been destroyed, releasing the directory entries and Chunks
+     * which were shared once every Snapshot has been
+     */
+    void pruneSnapshots();
+
+    /**
+     * @brief Returns whether a live Snapshot shares the given Chunk
+     */
+    bool isShared(const Chunk *chunk) const;
+
+    /**
+     * @brief Allocates an unlinked copy of the given Chunk, with its elements in the same slots
+     */
+    Chunk *copyChunk(const Chunk *chunk);
+
+    /**
+     * @brief Returns the given Chunk if it can be modified, or replaces it with a copy if it is shared with a Snapshot,
+     * pruning the destroyed Snapshots first
+     * @return The Chunk which holds the given Chunk's elements afterwards
+     */
+    Chunk *writableChunk(Chunk *chunk);
+
+    /**
+     * @brief Returns the given Chunk if it can be modified through an Iterator, checking only its epoch while it is
+     * the ChunkedList's own, or replaces it with a copy if it is shared with a Snapshot. The Snapshots aren't pruned,
+     * so that a replaced Chunk which other Iterators still point to stays allocated
+     * @return The Chunk which holds the given Chunk's elements afterwards
+     */
+    Chunk *writableIteratorChunk(Chunk *chunk);
+
+    /**
+     * @brief Replaces the given Chunk with a copy if it is shared with a live Snapshot, which then owns the original,
+     * and otherwise stamps it with the current epoch. A Chunk which has already been replaced is resolved to its copy
+     * @return The Chunk which holds the given Chunk's elements afterwards
+     */
+    Chunk *unshareChunk(Chunk *chunk);
+
+    /**
+     * @brief Replaces every Chunk shared with a live Snapshot with a copy, before elements are moved across all of them
+     */
+    void unshareChunks();
+
+    /**
+     * @brief Hands the given unlinked Chunk over to the live Snapshots sharing it, to be deallocated after the last of
+     * them is destroyed
+     * @return True if the Chunk was shared, otherwise false, in which case the ChunkedList still owns it
+     */
+    bool retireShared(Chunk *chunk);
+
+    /**
+     * @brief Returns the Chunk holding the element at the given index, and the slot of the element within it
+     */
+    std::pair<Chunk *, size_t> locate(size_t index) const;
+
     template<typename ChunkT>
     class GenericChunkIterator {
+      using ListT = std::conditional_t<std::is_const_v<ChunkT>, const ChunkedList, ChunkedList>;
+
       public:
         // stl compatibility
 
-        using value_type = ChunkT;
+        using value_type = std::remove_const_t<ChunkT>;
         using difference_type = std::ptrdiff_t;
         using pointer = ChunkT *;
         using reference = ChunkT &;
-        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+
+        GenericChunkIterator() = default;
 
         /**
          * @brief The pointer constructor for GenericChunkIterator
          * @param chunkPtr A pointer to a ChunkT object
+         * @param list The ChunkedList holding the Chunk, whose chunk directory is used for jumping between Chunks
          */
-        explicit GenericChunkIterator(ChunkT *chunkPtr);
+        explicit GenericChunkIterator(ChunkT *chunkPtr, ListT *list = nullptr);
 
         /**
          * @brief The reference constructor for GenericChunkIterator
          * @param chunkRef A reference to a ChunkT object
+         * @param list The ChunkedList holding the Chunk, whose chunk directory is used for jumping between Chunks
          */
-        explicit GenericChunkIterator(ChunkT &chunkRef);
+        explicit GenericChunkIterator(ChunkT &chunkRef, ListT *list = nullptr);
 
         ~GenericChunkIterator() = default;
 
@@ -109,7 +946,7 @@ class ChunkedList {
          * @brief Prefix increment operator, incrementing the chunk pointer by one
          * @return The incremented GenericIterator
          */
-        GenericChunkIterator operator++();
+        GenericChunkIterator &operator++();
 
         /**
          * @brief Postfix increment operator, incrementing the chunk pointer by one
@@ -121,7 +958,7 @@ class ChunkedList {
          * @brief Prefix decrement operator, decrement the chunk pointer by one
          * @return The decremented GenericIterator
          */
-        GenericChunkIterator operator--();
+        GenericChunkIterator &operator--();
 
         /**
          * @brief Postfix decrement operator, decrementing the chunk pointer by one
@@ -131,37 +968,60 @@ class ChunkedList {
 
         /**
          * @param offset The number of positions to advance the iterator forwards by
-         * @return The iterator advanced forward by the given number of positions
+         * @return The iterator advanced forward by the given number of positions, in O(1) through the chunk directory
          */
-        GenericChunkIterator operator+(size_t offset) const;
+        GenericChunkIterator operator+(difference_type offset) const;
 
         /**
          * @param offset The number of positions to move the iterator backwards by
-         * @return The iterator moved backwards by the given number of positions
+         * @return The iterator moved backwards by the given number of positions, in O(1) through the chunk directory
+         */
+        GenericChunkIterator operator-(difference_type offset) const;
+
+        /**
+         * @param offset The number of positions to advance the iterator forwards by
+         * @param iterator The iterator to advance
+         * @return The iterator advanced forward by the given number of positions
+         */
+        friend GenericChunkIterator operator+(const difference_type offset, const GenericChunkIterator &iterator) {
+          return iterator + offset;
+        }
+
+        /**
+         * @brief Returns the number of Chunks between the other iterator and the given one
+         * @param other The iterator to measure the distance from
+         * @return The number of Chunks from the other iterator to the given one
          */
-        GenericChunkIterator operator-(size_t offset) const;
+        difference_type operator-(const GenericChunkIterator &other) const;
 
         /**
          * @brief Advances the given iterator forwards by a given number of positions
          * @param offset The number of positions to advance the iterator by
          * @return The iterator advanced forward by the given number of positions
          */
-        GenericChunkIterator operator+=(size_t offset);
+        GenericChunkIterator &operator+=(difference_type offset);
 
         /**
          * @brief Moves the given iterator backwards by a given number of positions
          * @param offset The number of positions to move the iterator by
          * @return The iterator moved backward by the given number of positions
          */
-        GenericChunkIterator operator-=(size_t offset);
+        GenericChunkIterator &operator-=(difference_type offset);
+
+        /**
+         * @param offset The number of positions ahead of the iterator
+         * @return A reference to the Chunk the given number of positions ahead of the iterator
+         */
+        ChunkT &operator[](difference_type offset) const;
 
         /**
          * @brief Compares the given object with another for equality
          * @tparam ChunkIteratorT The type of object which will be compared to the given iterator
          * @param other The object which will be compared to the given iterator
-         * @return True if the given object's chunk pointer is equal to the other's, otherwise false
+         * @return True if the given object's chunk is at the same position as the other's, which it is after either
+         * Chunk was replaced with its copy, otherwise false
          */
-        template<typename ChunkIteratorT>
+        template<typename ChunkIteratorT> requires chunked_list_utility::is_generic_chunk_iterator<ChunkedList, ChunkIteratorT>
         bool operator==(ChunkIteratorT other) const;
 
         /**
@@ -170,35 +1030,60 @@ class ChunkedList {
          * @param other The object which will be compared to the given iterator
          * @return True if the given object's chunk is unequal to the other's, otherwise false
          */
-        template<typename ChunkIteratorT>
+        template<typename ChunkIteratorT> requires chunked_list_utility::is_generic_chunk_iterator<ChunkedList, ChunkIteratorT>
         bool operator!=(ChunkIteratorT other) const;
 
         /**
-         * @brief Dereferences the iterator
-         * @return A reference to the chunk, of type ChunkT, stored by the iterator
+         * @brief Orders the given iterator relative to another, by the positions of their Chunks
+         * @param other The iterator which will be compared to the given iterator
+         * @return The ordering of the given iterator's Chunk relative to the other's
          */
-        ChunkT &operator*();
+        std::strong_ordering operator<=>(const GenericChunkIterator &other) const;
 
         /**
-         * @brief Const dereferences the iterator
-         * @return A const reference to the chunk, of type ChunkT, stored by the iterator
+         * @brief Dereferences the iterator, first replacing a Chunk shared with a Snapshot with a copy unless ChunkT is
+         * const
+         * @return A reference to the chunk, of type ChunkT, stored by the iterator
          */
-        const ChunkT &operator*() const;
+        ChunkT &operator*() const;
 
         /**
-         * @brief Allows direct access to the members of the chunk stored within the iterator, of type ChunkT
+         * @brief Allows direct access to the members of the chunk stored within the iterator, of type ChunkT, first
+         * replacing a Chunk shared with a Snapshot with a copy unless ChunkT is const
          * @return A pointer to the chunk stored within the iterator, of type ChunkT
          */
-        ChunkT *operator->();
+        ChunkT *operator->() const;
+
+        /**
+         * @brief A get function, returning the private chunk member without copying it if it is shared, to read it
+         * @return The chunk pointed to by the given iterator
+         */
+        ChunkT *getChunk() const;
+
+        /**
+         * @brief A get function, returning the private list member
+         * @return The ChunkedList iterated over by the given iterator
+         */
+        ListT *getList() const;
+
+        /**
+         * @brief Returns the chunk directory of the ChunkedList iterated over
+         * @return The chunk directory used by the given iterator
+         */
+        const ChunkDirectory *getDirectory() const;
 
         /**
-         * @brief Allows direct const access to the members of the chunk stored within the iterator, of type ChunkT
-         * @return A const pointer to the chunk stored within the iterator, of type ChunkT
+         * @brief Returns the index of the iterator's Chunk within the chunk directory
+         * @return The directory index of the Chunk, or the number of Chunks if the iterator is past the back Chunk
          */
-        const ChunkT *operator->() const;
+        size_t getDirectoryIndex() const;
 
       private:
-        ChunkT *chunk{nullptr};
+        /**
+         * @brief Mutable, as dereferencing the iterator moves it onto the copy of a Chunk shared with a Snapshot
+         */
+        mutable ChunkT *chunk{nullptr};
+        ListT *list{nullptr};
     };
 
     template<typename ChunkT, typename ValueT>
@@ -207,11 +1092,14 @@ class ChunkedList {
 
       public:
         // stl compatibility
-        using value_type = ValueT;
+        using value_type = std::remove_const_t<ValueT>;
         using difference_type = std::ptrdiff_t;
         using pointer = ValueT *;
         using reference = ValueT &;
-        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+
+        GenericIterator() = default;
 
         /**
          * @brief Initialises the GenericIterator with a specified chunk pointer and optional index
@@ -231,56 +1119,78 @@ class ChunkedList {
         ~GenericIterator() = default;
 
         /**
-         * @brief Prefix increment operator, incrementing the index by one unless it is equal to the ChunkSize, in which case incrementing the chunkIterator member by one
+         * @brief Prefix increment operator, incrementing the index by one, moving onto the start of the next Chunk once the index reaches the Chunk's next index
          * @return The incremented GenericIterator
          */
-        GenericIterator operator++();
+        GenericIterator &operator++();
 
         /**
-         * @brief Prefix increment operator, incrementing the index by one unless it is equal to the ChunkSize, in which case incrementing the chunkIterator member by one
+         * @brief Prefix increment operator, incrementing the index by one, moving onto the start of the next Chunk once the index reaches the Chunk's next index
          * @return The original GenericIterator
          */
         GenericIterator operator++(int);
 
         /**
-         * @brief Prefix decrement operator, decrementing the index by one unless it is equal to 0, in which case decrementing the chunkIterator member by one
+         * @brief Prefix decrement operator, decrementing the index by one unless it is equal to 0, in which case moving onto the last element of the previous Chunk
          * @return The decremented GenericIterator
          */
-        GenericIterator operator--();
+        GenericIterator &operator--();
 
         /**
-         * @brief Postfix decrement operator, decrementing the index by one unless it is equal to 0, in which case decrementing the chunkIterator member by one
+         * @brief Postfix decrement operator, decrementing the index by one unless it is equal to 0, in which case moving onto the last element of the previous Chunk
          * @return The original GenericIterator
          */
         GenericIterator operator--(int);
 
         /**
-         * @brief Returns the given iterator advanced forward a given number of positions
+         * @brief Returns the given iterator advanced forward a given number of positions, in O(1) through the chunk directory while it is dense, and in O(log n) otherwise
          * @param offset The number of positions to advance the iterator by
          * @return The iterator advanced forward by a given number of positions
          */
-        GenericIterator operator+(size_t offset);
+        GenericIterator operator+(difference_type offset) const;
 
         /**
-         * @brief Returns the given iterator moved backwards a given number of positions
+         * @brief Returns the given iterator moved backwards a given number of positions, in O(1) through the chunk directory while it is dense, and in O(log n) otherwise
          * @param offset The number of positions to move the iterator by
          * @return The iterator moved backward by a given number of positions
          */
-        GenericIterator operator-(size_t offset);
+        GenericIterator operator-(difference_type offset) const;
+
+        /**
+         * @param offset The number of positions to advance the iterator forwards by
+         * @param iterator The iterator to advance
+         * @return The iterator advanced forward by the given number of positions
+         */
+        friend GenericIterator operator+(const difference_type offset, const GenericIterator &iterator) {
+          return iterator + offset;
+        }
+
+        /**
+         * @brief Returns the number of elements between the other iterator and the given one
+         * @param other The iterator to measure the distance from
+         * @return The number of elements from the other iterator to the given one
+         */
+        difference_type operator-(const GenericIterator &other) const;
 
         /**
          * @brief Advances the given iterator forwards by a given number of positions
          * @param offset The number of positions to advance the iterator by
          * @return The iterator advanced forward by the given number of positions
          */
-        GenericIterator operator+=(size_t offset);
+        GenericIterator &operator+=(difference_type offset);
 
         /**
          * @brief Moves the given iterator backwards by a given number of positions
          * @param offset The number of positions to move the iterator by
          * @return The iterator moved backward by the given number of positions
          */
-        GenericIterator operator-=(size_t offset);
+        GenericIterator &operator-=(difference_type offset);
+
+        /**
+         * @param offset The number of positions ahead of the iterator
+         * @return A reference to the value the given number of positions ahead of the iterator
+         */
+        ValueT &operator[](difference_type offset) const;
 
         /**
          * @brief Compares the given object with another for equality
@@ -288,7 +1198,7 @@ class ChunkedList {
          * @param other The object which will be compared to the given iterator
          * @return True if the given object's index and chunkIterator are equal to the other's index and chunkIterator
          */
-        template<typename IteratorT>
+        template<typename IteratorT> requires chunked_list_utility::is_generic_iterator<ChunkedList, IteratorT>
         bool operator==(IteratorT other) const;
 
         /**
@@ -297,32 +1207,27 @@ class ChunkedList {
          * @param other The object which will be compared to the given iterator
          * @return True if the given object's index is unequal to the other's or the given object's chunkIterator is unequal to the other's, otherwise false
          */
-        template<typename IteratorT>
+        template<typename IteratorT> requires chunked_list_utility::is_generic_iterator<ChunkedList, IteratorT>
         bool operator!=(IteratorT other) const;
 
         /**
-         * @brief Dereferences the iterator
-         * @return A reference to value, of type ValueT, stored within the current chunk at the current index
+         * @brief Orders the given iterator relative to another, by the positions of the elements they reference
+         * @param other The iterator which will be compared to the given iterator
+         * @return The ordering of the given iterator's element relative to the other's
          */
-        ValueT &operator*();
+        std::strong_ordering operator<=>(const GenericIterator &other) const;
 
         /**
-         * @brief Dereferences the iterator (const)
-         * @return A const reference to the value, of type ValueT, stored within the current chunk at the current index
+         * @brief Dereferences the iterator
+         * @return A reference to value, of type ValueT, stored within the current chunk at the current index
          */
-        const ValueT &operator*() const;
+        ValueT &operator*() const;
 
         /**
          * @brief Allows direct access to the members of the object "stored" within the iterator, of type ValueT
          * @return A pointer to the object "stored" within the iterator, of type ValueT
          */
-        ValueT *operator->();
-
-        /**
-         * @brief Allows direct const access to the members of the object "stored" within the iterator, of type ValueT
-         * @return A const pointer to the object "stored" within the iterator, of type ValueT
-         */
-        const ValueT *operator->() const;
+        ValueT *operator->() const;
 
         /**
          * @brief A get function, returning the private index member
@@ -341,6 +1246,14 @@ class ChunkedList {
         size_t index{0};
     };
 
+    /**
+     * @brief Maps a Chunk to a span over its constructed elements, for the views returned by chunks
+     */
+    template<typename ChunkT, typename ValueT>
+    struct GenericChunkSpan {
+      std::span<ValueT> operator()(ChunkT &chunk) const;
+    };
+
   public:
     /**
      * @brief The default constructor for ChunkedList, allocating a single Chunk for the front and back
@@ -353,11 +1266,67 @@ class ChunkedList {
      */
     ChunkedList(std::initializer_list<T> initializerList);
 
+    /**
+     * @brief Constructs an empty ChunkedList which allocates its Chunks from the given ChunkSlab, such as one backed by
+     * huge pages on a chosen NUMA node, instead of allocating each Chunk with new
+     * @param slab The ChunkSlab, whose blocks must be at least chunked_list_utility::chunk_bytes<T>(ChunkSize) bytes,
+     * aligned to chunked_list_utility::chunk_alignment<T>. Copies of the ChunkedList share it. Constructing from one
+     * requires ChunkSlab.hpp to be included
+     * @throws std::invalid_argument If the ChunkSlab's blocks are too small or not aligned enough for a Chunk
+     */
+    template<std::same_as<ChunkSlab> Slab>
+    explicit ChunkedList(std::shared_ptr<Slab> slab);
+
+    /**
+     * @brief The copy constructor for ChunkedList, copying the other container a whole Chunk at a time
+     * @param other The ChunkedList to copy
+     */
+    ChunkedList(const ChunkedList &other);
+
+    /**
+     * @brief The move constructor for ChunkedList, taking the other container's Chunks without allocating, so that
+     * containers such as std::vector move ChunkedLists rather than copying them
+     * @param other The ChunkedList to move from, which is left empty without any Chunk until elements are added to it
+     */
+    ChunkedList(ChunkedList &&other) noexcept;
+
+    /**
+     * @brief The copy assignment operator for ChunkedList, replacing the elements with copies of the other's
+     * @param other The ChunkedList to copy
+     * @return The given ChunkedList
+     */
+    ChunkedList &operator=(const ChunkedList &other);
+
+    /**
+     * @brief The move assignment operator for ChunkedList, exchanging Chunks with the other container
+     * @param other The ChunkedList to move from, which is left with the given container's previous elements
+     * @return The given ChunkedList
+     */
+    ChunkedList &operator=(ChunkedList &&other) noexcept;
+
     /**
      * @brief The destructor for ChunkedList, deallocating each chunk starting from the back
      */
     ~ChunkedList();
 
+    /**
+     * @brief Exchanges the Chunks of the given ChunkedList with the other's, without copying or moving any elements
+     * @param other The ChunkedList to exchange Chunks with
+     */
+    void swap(ChunkedList &other) noexcept;
+
+    /**
+     * @brief Moves every element of the other ChunkedList to the back of the given one by relinking the other's Chunks
+     * @param other The ChunkedList whose elements are taken, which is left empty
+     */
+    void splice(ChunkedList &&other);
+
+    /**
+     * @brief Moves every element of the other ChunkedList to the back of the given one by relinking the other's Chunks
+     * @param other The ChunkedList whose elements are taken, which is left empty
+     */
+    void append(ChunkedList &&other);
+
     /**
     * @brief The non-const ChunkIterator class used to iterate through each Chunk in the ChunkedList
     */
@@ -379,19 +1348,217 @@ class ChunkedList {
     using ConstIterator = GenericIterator<const Chunk, const T>;
 
     /**
-     * @brief Direct ChunkedList indexing, of O(n/k) search complexity, where n is the index and k is the ChunkSize
+     * @brief A random access view of a std::span over the elements of each Chunk in the ChunkedList
+     */
+    using ChunkSpanRange = std::ranges::transform_view<std::ranges::subrange<ChunkIterator>, GenericChunkSpan<Chunk, T> >;
+
+    /**
+     * @brief A random access view of a std::span over the const elements of each Chunk in the ChunkedList
+     */
+    using ConstChunkSpanRange = std::ranges::transform_view<std::ranges::subrange<ConstChunkIterator>,
+      GenericChunkSpan<const Chunk, const T> >;
+
+    /**
+     * @class Snapshot
+     * @brief An immutable view of the elements of a ChunkedList at the time snapshot was called, which shares the
+     * ChunkedList's Chunks instead of copying them.
+     *
+     * Only a partially filled back Chunk is copied when the Snapshot is taken. Afterwards, the ChunkedList copies a
+     * shared Chunk before modifying it in place, and hands a shared Chunk it pops or replaces over to the Snapshots,
+     * which deallocate it once the last of them is destroyed. A Snapshot and its copies can be read from any thread
+     * while the ChunkedList keeps being modified by one thread, and can outlive the ChunkedList.
+     */
+    class Snapshot {
+      friend class ChunkedList;
+
+      /**
+       * @brief Maps the index of a Chunk in the Snapshot to a span over its elements
+       */
+      struct ChunkSpan {
+        const SnapshotState *state{nullptr};
+
+        std::span<const T> operator()(size_t chunk) const;
+      };
+
+      std::shared_ptr<SnapshotState> state{};
+
+      explicit Snapshot(std::shared_ptr<SnapshotState> state);
+
+      public:
+        /**
+         * @brief A forward iterator through the elements of a Snapshot
+         */
+        class ConstIterator {
+          public:
+            // stl compatibility
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T *;
+            using reference = const T &;
+            using iterator_category = std::forward_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+
+            ConstIterator() = default;
+
+            ConstIterator(const SnapshotState *state, size_t chunk, size_t index);
+
+            /**
+             * @brief Prefix increment operator, moving onto the start of the next Chunk once the index reaches the
+             * Chunk's next index
+             * @return The incremented ConstIterator
+             */
+            ConstIterator &operator++();
+
+            /**
+             * @brief Postfix increment operator, moving onto the start of the next Chunk once the index reaches the
+             * Chunk's next index
+             * @return The original ConstIterator
+             */
+            ConstIterator operator++(int);
+
+            const T &operator*() const;
+
+            const T *operator->() const;
+
+            bool operator==(const ConstIterator &other) const;
+
+          private:
+            const SnapshotState *state{nullptr};
+            size_t chunk{0};
+            size_t index{0};
+        };
+
+        /**
+         * @brief A random access view of a std::span over the elements of each Chunk in the Snapshot
+         */
+        using ConstChunkSpanRange = std::ranges::transform_view<std::ranges::iota_view<size_t, size_t>, ChunkSpan>;
+
+        /**
+         * @brief Creates an empty Snapshot, which isn't of any ChunkedList
+         */
+        Snapshot() = default;
+
+        /**
+         * @brief Shares the other Snapshot's view of the ChunkedList, in O(1)
+         */
+        Snapshot(const Snapshot &other);
+
+        Snapshot(Snapshot &&other) noexcept;
+
+        Snapshot &operator=(const Snapshot &other);
+
+        Snapshot &operator=(Snapshot &&other) noexcept;
+
+        /**
+         * @brief Stops using the shared Chunks, deallocating those the ChunkedList has released if this was the last
+         * Snapshot using them
+         */
+        ~Snapshot();
+
+        /**
+         * @brief Direct Snapshot indexing, of O(1) complexity if the ChunkedList's chunk directory was dense, and
+         * O(log n) otherwise
+         * @param index The index of the element in the Snapshot
+         * @return A const reference to the value at the index
+         */
+        const T &operator[](size_t index) const;
+
+        /**
+         * @return A const reference to the first element, which must exist
+         */
+        const T &front() const;
+
+        /**
+         * @return A const reference to the last element, which must exist
+         */
+        const T &back() const;
+
+        /**
+         * @brief Returns a ConstIterator to the first element
+         */
+        ConstIterator begin() const;
+
+        /**
+         * @brief Returns a ConstIterator to the element after the last
+         */
+        ConstIterator end() const;
+
+        /**
+         * @brief Returns a view of the elements of each Chunk as a std::span, so that the segmented algorithms can be
+         * used on a Snapshot as on a ChunkedList
+         */
+        ConstChunkSpanRange chunks() const;
+
+        /**
+         * @brief Returns the number of elements in the Snapshot
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns whether the Snapshot holds no elements
+         */
+        bool empty() const;
+    };
+
+    /**
+     * @brief Takes an immutable Snapshot of the elements, which shares every Chunk but a partially filled back Chunk
+     * with the ChunkedList, so it costs O(1) and a copy of at most one Chunk however many elements there are.
+     * Shared Chunks are copied when they are first modified, through indexing, front, back, popping or erasure, or all
+     * at once by the first non-const begin, end or chunks, as Iterators can modify any Chunk. Iterators obtained
+     * before the Snapshot was taken must not be used to modify elements
+     * @return A Snapshot of the ChunkedList's elements
+     */
+    Snapshot snapshot() requires std::is_copy_constructible_v<T>;
+
+  protected:
+    /**
+     * @brief Returns an Iterator to the given index of the given Chunk, moving onto the next Chunk if the index is after
+     * the Chunk's last element
+     */
+    Iterator makeIterator(Chunk *chunk, size_t index);
+
+  public:
+
+    /**
+     * @brief Direct ChunkedList indexing, of O(1) complexity through the chunk directory while it is dense, and
+     * O(log n) otherwise
      * @param index The index of the element in the ChunkedList
      * @return A reference to the value at the index
      */
     T &operator[](size_t index);
 
     /**
-      * @brief Direct const ChunkedList indexing, of O(n/k) search complexity, where n is the index and k is the ChunkSize
+      * @brief Direct const ChunkedList indexing, of O(1) complexity through the chunk directory while it is dense,
+      * and O(log n) otherwise
       * @param index The index of the element in the ChunkedList
       * @return A const reference to the value at the index
       */
     const T &operator[](size_t index) const;
 
+    /**
+     * @brief Returns the first element, which is the next one popFront destroys
+     * @return A reference to the first element in the ChunkedList, which must not be empty
+     */
+    T &front();
+
+    /**
+     * @brief Returns the first element, which is the next one popFront destroys
+     * @return A const reference to the first element in the ChunkedList, which must not be empty
+     */
+    const T &front() const;
+
+    /**
+     * @brief Returns the last element, which is the next one pop destroys
+     * @return A reference to the last element in the ChunkedList, which must not be empty
+     */
+    T &back();
+
+    /**
+     * @brief Returns the last element, which is the next one pop destroys
+     * @return A const reference to the last element in the ChunkedList, which must not be empty
+     */
+    const T &back() const;
+
     /**
      * @brief Returns an Iterator to the first element
      * @returns An Iterator referencing the first element in the container
@@ -441,29 +1608,258 @@ class ChunkedList {
     ConstChunkIterator endChunk() const;
 
     /**
-     * @brief Pushes an element to the front of the ChunkedList
+     * @brief Returns a view of the elements of each Chunk as a std::span, so that each Chunk can be iterated over as an
+     * array. Only the front and back Chunks can be partially filled, or empty, while the ChunkedList is only pushed to
+     * and popped from the front
+     * @returns A ChunkSpanRange over every Chunk in the container
+     */
+    ChunkSpanRange chunks();
+
+    /**
+     * @brief Returns a view of the const elements of each Chunk as a std::span
+     * @returns A ConstChunkSpanRange over every Chunk in the container
+     */
+    ConstChunkSpanRange chunks() const;
+
+    /**
+     * @brief Pushes an element to the back of the ChunkedList
      * @param value The element which will be pushed to the back of the container
      */
     void push(T value);
 
     /**
-     * @brief Pushes an element to the ChunkedList, but constructs it within the emplace function
+     * @brief Pushes an element to the ChunkedList, constructing it in place from the given arguments
+     * @tparam Args The types of the arguments used to construct the object
+     * @param args The arguments used to construct the object
+     * @return A reference to the constructed element
+     */
+    template<typename... Args>
+    T &emplace(Args &&... args);
+
+    /**
+     * @brief Pushes an element to the front of the ChunkedList, in O(1) without moving any other element
+     * @param value The element which will be pushed to the front of the container
+     */
+    void pushFront(T value);
+
+    /**
+     * @brief Pushes an element to the front of the ChunkedList, constructing it in place from the given arguments. A
+     * full front Chunk gets a new Chunk linked before it, which is filled from the end of its storage towards the start
      * @tparam Args The types of the arguments used to construct the object
      * @param args The arguments used to construct the object
+     * @return A reference to the constructed element
      */
     template<typename... Args>
-    void emplace(Args &&... args);
+    T &emplaceFront(Args &&... args);
+
+    /**
+     * @brief Appends a range of elements to the back of the ChunkedList, filling whole Chunks at once
+     * @param first An iterator to the first element to append
+     * @param last The iterator or sentinel after the last element to append
+     */
+    template<std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+    void append(InputIterator first, Sentinel last);
+
+    /**
+     * @brief Appends every element of a range to the back of the ChunkedList, filling whole Chunks at once
+     * @param range The range of elements to append
+     */
+    template<std::ranges::input_range Range>
+    void append(Range &&range);
+
+    /**
+     * @brief Allocates enough spare Chunks for the ChunkedList to hold the given number of elements without allocating
+     * @param capacity The number of elements which should fit in the ChunkedList
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * @brief Pops elements from, or appends value-initialised elements to, the back until the size is the given size
+     * @param size The new number of elements in the ChunkedList
+     */
+    void resize(size_t size);
+
+    /**
+     * @brief Pops elements from, or appends copies of the value to, the back until the size is the given size
+     * @param size The new number of elements in the ChunkedList
+     * @param value The value which appended elements are copied from
+     */
+    void resize(size_t size, const T &value);
+
+    /**
+     * @brief Returns the number of elements the ChunkedList can hold before it has to allocate another Chunk
+     * @return The size, plus the free space in the back Chunk and in each spare Chunk
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief A summary of the memory a ChunkedList uses, as returned by stats
+     */
+    struct Stats {
+      /**
+       * @brief The number of Chunks linked into the ChunkedList, which is at least 1
+       */
+      size_t chunkCount{0};
+
+      /**
+       * @brief The number of popped Chunks kept for reuse by the retention policy
+       */
+      size_t spareChunkCount{0};
+
+      size_t elementCount{0};
+
+      /**
+       * @brief The bytes allocated for the linked and spare Chunks, and for the chunk directory
+       */
+      size_t bytesAllocated{0};
+
+      /**
+       * @brief The bytes of element storage left unused in the linked Chunks, which are those past the back Chunk's
+       * elements, before the front Chunk's, and in Chunks left partially filled by insertion and erasure
+       */
+      size_t bytesWasted{0};
+
+      /**
+       * @brief The proportion of element storage in the linked Chunks which holds elements, from 0 to 1
+       */
+      double fillRatio{0};
+    };
+
+    /**
+     * @brief Returns how much memory the ChunkedList uses, and how much of it holds elements, in O(1) from the counts
+     * the ChunkedList already keeps
+     */
+    Stats stats() const;
+
+#ifdef CHUNKED_LIST_COUNTERS
+    /**
+     * @brief The number of times each operation has happened, over every ChunkedList<T, ChunkSize>, as returned by
+     * counters
+     */
+    struct Counters {
+      size_t chunkAllocations{0};
+      size_t chunkDeallocations{0};
+
+      /**
+       * @brief The number of elements pushed or emplaced to the front or back
+       */
+      size_t pushes{0};
+
+      /**
+       * @brief The number of elements popped from the front or back
+       */
+      size_t pops{0};
+
+      /**
+       * @brief The number of times an iterator has followed a link to the next or previous Chunk
+       */
+      size_t chunkHops{0};
+    };
+
+    /**
+     * @brief Returns the counters of every ChunkedList<T, ChunkSize>, which are only kept when CHUNKED_LIST_COUNTERS is
+     * defined. Each counter is a relaxed atomic, so they can be read while other threads use their own ChunkedLists
+     */
+    static Counters counters();
+
+    /**
+     * @brief Sets every counter of ChunkedList<T, ChunkSize> back to 0
+     */
+    static void resetCounters();
+#endif
+
+    /**
+     * @brief Inserts an element before the given position, shifting only the elements of the Chunk it lands in and
+     * splitting the Chunk into two if it is full, in O(ChunkSize + log n)
+     * @param position An iterator to the element which the value is inserted before
+     * @param value The element to insert
+     * @return An Iterator to the inserted element
+     */
+    Iterator insert(Iterator position, T value);
+
+    /**
+     * @brief Inserts a range of elements before the given position, in new Chunks linked after the one it lands in
+     * @param position An iterator to the element which the range is inserted before
+     * @param first An iterator to the first element to insert
+     * @param last The iterator or sentinel after the last element to insert
+     * @return An Iterator to the first inserted element, or the given position if the range is empty
+     */
+    template<std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+    Iterator insert(Iterator position, InputIterator first, Sentinel last);
+
+    /**
+     * @brief Erases the element at the given position, shifting only the elements of its Chunk and merging the Chunk
+     * with a neighbour if it becomes under half full, in O(ChunkSize + log n)
+     * @param position An iterator to the element to erase
+     * @return An Iterator to the element after the erased one
+     */
+    Iterator erase(Iterator position);
+
+    /**
+     * @brief Erases the elements in the given range, unlinking Chunks which are erased entirely
+     * @param first An iterator to the first element to erase
+     * @param last An iterator to the element after the last one to erase
+     * @return An Iterator to the element after the erased ones
+     */
+    Iterator erase(Iterator first, Iterator last);
+
+    /**
+     * @brief Erases every element which satisfies the predicate in a single pass, moving the remaining elements forwards
+     * across Chunks to close the gaps without allocating, and releasing the Chunks left empty at the back
+     * @param predicate Called with a const reference to each element, returning true for the elements to erase
+     * @return The number of erased elements
+     */
+    template<std::predicate<const T &> Predicate>
+    size_t eraseIf(Predicate predicate);
 
     /**
-     * @brief Pops the most recent item from the back Chunk of the ChunkedList
+     * @brief Keeps only the elements which satisfy the predicate, erasing the others in a single pass like eraseIf
+     * @param predicate Called with a const reference to each element, returning true for the elements to keep
+     * @return The number of erased elements
+     */
+    template<std::predicate<const T &> Predicate>
+    size_t retain(Predicate predicate);
+
+    /**
+     * @brief Pops and destroys the most recent item from the back Chunk of the ChunkedList
      */
     void pop();
 
     /**
-     * @brief Pops the back (most recent) Chunk from the ChunkedList
+     * @brief Pops the back (most recent) Chunk from the ChunkedList, destroying each of its elements
      */
     void popChunk();
 
+    /**
+     * @brief Pops and destroys the first element, so that the ChunkedList can be used as a FIFO queue. The front Chunk
+     * is unlinked and released, to be recycled by later pushes, once all of its elements have been popped
+     */
+    void popFront();
+
+    /**
+     * @brief Pops and destroys the given number of elements from the front of the ChunkedList, or every element if it
+     * holds fewer
+     * @param count The number of elements to pop
+     */
+    void popFront(size_t count);
+
+    /**
+     * @brief Sets how many popped Chunks are kept for reuse by later pushes instead of being deallocated
+     * @param policy Whether the limit applies to the number of spare Chunks or to the total number of Chunks
+     * @param limit The maximum number of spare Chunks, or the high-water mark of live and spare Chunks
+     */
+    void setRetentionPolicy(RetentionPolicy policy, size_t limit);
+
+    /**
+     * @brief Deallocates every spare Chunk kept for reuse
+     */
+    void shrinkToFit();
+
+    /**
+     * @brief Returns the ChunkSlab the Chunks are allocated from, or null if they are allocated with new
+     */
+    const std::shared_ptr<ChunkSlab> &slab() const;
+
     /**
      * @brief Sorts the ChunkedList with a template-decided comparison class and sorting algorithm
      * @tparam Compare The Compare class used in the sorting algorithm
@@ -474,13 +1870,13 @@ class ChunkedList {
 
     /**
      * @brief Returns the total number of elements stored in the ChunkedList
-     * @return The number of Chunks - 1 multiplied by the ChunkSize, plus the back Chunk's next index
+     * @return The number of elements, which is tracked as elements are added and removed
      */
     size_t size() const;
 
     /**
      * @brief Returns whether the ChunkedList is empty
-     * @return True if front Chunk's next index is 0, otherwise false
+     * @return True if the ChunkedList holds no elements, otherwise false
      */
     bool empty() const;
 
@@ -499,16 +1895,52 @@ class ChunkedList {
     bool operator!=(const ChunkedList &other) const;
 
     /**
-     * @brief Inserts the ChunkedList to an ostream
-     * @param os The ostream to insert the container's elements to
-     * @param chunkedList The given container
-     * @return The ostream object given by the os argument
+     * @brief Writes a binary snapshot of the ChunkedList, which a MappedChunkedList can read without copying: a header
+     * holding the type size, ChunkSize, element count and a checksum, followed by the elements of each Chunk
+     * @param os The ostream to write the snapshot to, which should be opened in binary mode
+     */
+    void save(std::ostream &os) const requires std::is_trivially_copyable_v<T>;
+
+    /**
+     * @brief Writes a binary snapshot of the ChunkedList to the file at the given path, replacing its contents
+     * @param path The path of the file to write the snapshot to
+     * @throws std::ios_base::failure If the file can't be opened or written to
+     */
+    void save(const std::filesystem::path &path) const requires std::is_trivially_copyable_v<T>;
+
+    /**
+     * @brief Returns the number of characters formatTo writes, counting the digits of integers without formatting them
+     * @param delimiter The divider between each element
+     * @return The length of every element formatted as formatTo formats it, and the delimiters between them
+     */
+    size_t formattedSize(std::string_view delimiter = ", ") const
+      requires chunked_list_utility::formatting::to_chars_formattable<T>;
+
+    /**
+     * @brief Formats the elements into the given buffer with std::to_chars, separated by the delimiter, without
+     * allocating. Floating-point elements are formatted in general form with a precision of 6, as an ostream formats
+     * them by default
+     * @param first The start of the buffer
+     * @param last The end of the buffer
+     * @param delimiter The divider between each element
+     * @return The end of the written characters, with std::errc::value_too_large if the buffer was too small, in which
+     * case the contents of the buffer are unspecified
+     */
+    std::to_chars_result formatTo(char *first, char *last, std::string_view delimiter = ", ") const
+      requires chunked_list_utility::formatting::to_chars_formattable<T>;
+
+    /**
+     * @brief Appends the elements to the string, formatted as by formatTo and separated by the delimiter. The
+     * string grows once, by the exact formatted size for integers and by an upper bound for floating-point types
+     * @param output The string which the elements are appended to
+     * @param delimiter The divider between each element
      */
-    template<typename, size_t, bool>
-    friend std::ostream &operator<<(std::ostream &os, ChunkedList &chunkedList);
+    void formatTo(std::string &output, std::string_view delimiter = ", ") const
+      requires chunked_list_utility::formatting::to_chars_formattable<T>;
 
     /**
-     * @brief Concatenates the elements of the ChunkedList
+     * @brief Concatenates the elements of the ChunkedList. Arithmetic elements concatenated into a std::string are
+     * formatted with formatTo rather than through the OutputStream
      * @tparam OutputStream The ostream to use for inserting elements
      * @tparam StringType The type of string which will be returned by 
      * @tparam SeparatorType The type of string used to store the delimiter
@@ -520,8 +1952,38 @@ class ChunkedList {
       typename BaseOutputStream = std::ostream,
       typename StringType = std::string,
       typename SeparatorType = std::string>
-    StringType concat(SeparatorType delimiter = ", ");
+    StringType concat(SeparatorType delimiter = ", ") const;
+};
+
+/**
+ * @brief Inserts the ChunkedList to an ostream, as its elements separated by commas in square brackets. Arithmetic
+ * elements are formatted with std::to_chars into a buffer, which is written to the ostream as it fills up, with
+ * floating-point elements taking the stream's precision. A stream whose flags, width or locale have been changed has
+ * each element inserted into it instead, and its width applies to every element rather than to the brackets
+ * @param os The ostream to insert the container's elements to
+ * @param chunkedList The given container
+ * @return The ostream object given by the os argument
+ */
+template<typename T, size_t ChunkSize>
+std::ostream &operator<<(std::ostream &os, const ChunkedList<T, ChunkSize> &chunkedList);
+
+#ifdef __cpp_lib_format
+/**
+ * @brief Formats a ChunkedList with std::format like operator<<, or without the square brackets given the n format
+ * specifier. Arithmetic elements are formatted as by formatTo a Chunk at a time, so floating-point elements take a
+ * precision of 6 rather than their shortest round-trip form, and other elements are formatted with their own
+ * std::formatter
+ */
+template<typename T, size_t ChunkSize>
+struct std::formatter<ChunkedList<T, ChunkSize>, char> {
+  bool brackets{true};
+
+  constexpr std::format_parse_context::iterator parse(std::format_parse_context &ctx);
+
+  template<typename FormatContext>
+  typename FormatContext::iterator format(const ChunkedList<T, ChunkSize> &chunkedList, FormatContext &ctx) const;
 };
+#endif
 
 /**
  * @brief Returns an Iterator to the first element in the given ChunkedList
@@ -567,11 +2029,57 @@ template<typename T, size_t ChunkSize>
 typename ChunkedList<T, ChunkSize>::ConstIterator
 end(const ChunkedList<T, ChunkSize> &chunkedList) noexcept;
 
+/**
+ * @brief Exchanges the Chunks of two ChunkedLists
+ * @tparam T The type stored in the containers
+ * @tparam ChunkSize The size of each Chunk within the containers
+ * @param lhs A reference to the first container object
+ * @param rhs A reference to the second container object
+ */
+template<typename T, size_t ChunkSize>
+void swap(ChunkedList<T, ChunkSize> &lhs, ChunkedList<T, ChunkSize> &rhs) noexcept;
+
+namespace chunked_list_utility::segmented {
+  /**
+   * @brief A container whose elements can be visited a Chunk at a time, through a range of spans returned by chunks
+   */
+  template<typename ChunkedListT>
+  concept chunked_range = std::ranges::sized_range<ChunkedListT> && requires(ChunkedListT &chunkedList)
+  {
+    requires std::convertible_to<std::ranges::range_reference_t<decltype(chunkedList.chunks())>,
+      std::span<const std::ranges::range_value_t<ChunkedListT> > >;
+  };
+
+  /**
+   * @brief Calls the function with a reference to every element, in a separate loop over each Chunk's elements
+   * @return The function, after it has been called with every element
+   */
+  template<chunked_range ChunkedListT, typename Function>
+  Function for_each(ChunkedListT &&chunkedList, Function function);
+
+  /**
+   * @brief Copies every element to the output, a Chunk at a time, which copies contiguous trivially copyable elements
+   * with memmove
+   * @return The output iterator advanced past the last copied element
+   */
+  template<chunked_range ChunkedListT, std::weakly_incrementable OutputIterator>
+  OutputIterator copy(const ChunkedListT &chunkedList, OutputIterator output);
+
+  /**
+   * @brief Assigns the value to every element, a Chunk at a time
+   */
+  template<chunked_range ChunkedListT>
+  void fill(ChunkedListT &chunkedList, const std::ranges::range_value_t<ChunkedListT> &value);
+}
+
 #undef DEBUG_LOG
 #undef DEBUG_LINE
 #undef DEBUG_EXECUTE
+#undef COUNTER_ADD
 
 #include "../src/ChunkedList.tpp"
 #include "../src/ChunkedListChunk.tpp"
+#include "../src/ChunkedListIndex.tpp"
 #include "../src/ChunkedListIterator.tpp"
+#include "../src/ChunkedListSnapshot.tpp"
 #include "../src/ChunkedListUtility.tpp"
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ChunkedList.hpp"
+
+namespace chunked_list_utility::parallel {
+  /**
+   * @class thread_pool
+   * @brief A work-stealing thread pool, where each worker runs the tasks of its own queue newest first and steals the
+   * oldest tasks from other workers' queues once its own is empty
+   */
+  class thread_pool {
+    using Task = std::function<void()>;
+
+    struct WorkerQueue {
+      std::mutex mutex{};
+      std::deque<Task> tasks{};
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue> > queues{};
+
+    std::vector<std::thread> workers{};
+
+    std::mutex sleepMutex{};
+
+    std::condition_variable sleepCondition{};
+
+    /**
+     * @brief The number of tasks which have been queued but not yet taken by a thread
+     */
+    std::atomic<size_t> queuedTasks{0};
+
+    bool stopping{false};
+
+    std::atomic<size_t> nextQueue{0};
+
+    /**
+     * @brief Takes a task from the given queue, or steals one from another queue, and runs it
+     * @return True if a task was run, otherwise false
+     */
+    bool runTask(size_t queueIndex);
+
+    /**
+     * @brief The index of the queue the current thread takes tasks from first, if it is a worker thread
+     */
+    static inline thread_local size_t currentQueue{0};
+
+    void workerLoop(size_t queueIndex);
+
+    public:
+      /**
+       * @brief Starts the given number of worker threads, which run tasks alongside the thread calling run
+       */
+      explicit thread_pool(size_t threadCount = std::thread::hardware_concurrency());
+
+      thread_pool(const thread_pool &) = delete;
+
+      thread_pool &operator=(const thread_pool &) = delete;
+
+      /**
+       * @brief Stops every worker thread, after the queued tasks have been run
+       */
+      ~thread_pool();
+
+      /**
+       * @brief Returns the number of threads which run tasks, including the thread waiting in run
+       */
+      size_t concurrency() const;
+
+      /**
+       * @brief Runs the function once for every task index below the task count, and waits for every task to finish.
+       * The calling thread runs tasks while it waits, so run may be called from within a task
+       * @param taskCount The number of tasks to run
+       * @param function The function which is called with each task index
+       */
+      template<typename Function>
+      void run(size_t taskCount, Function function);
+
+      /**
+       * @brief Returns the pool used when no executor is given, with a worker for every hardware thread but the caller's
+       */
+      static thread_pool &global();
+  };
+
+  /**
+   * @brief An executor which can run a number of indexed tasks in parallel, waiting for all of them to finish
+   */
+  template<typename Executor>
+  concept executor = requires(Executor &executor)
+  {
+    { executor.concurrency() } -> std::convertible_to<size_t>;
+    executor.run(size_t{}, [](size_t) {});
+  };
+
+  /**
+   * @brief Returns the number of tasks the Chunks of the ChunkedList are shared out into, which is a few per thread so
+   * that threads which finish early can steal the remaining tasks
+   */
+  template<typename ChunkedListT, executor Executor>
+  size_t chunk_task_count(const ChunkedListT &chunkedList, Executor &executor);
+
+  /**
+   * @brief Shares the Chunks of the ChunkedList out into contiguous ranges, one per task, calling the function with the
+   * first and last ChunkIterators of each range and the task index on the executor's threads
+   */
+  template<typename ChunkedListT, typename Function, executor Executor>
+  void run_chunk_tasks(ChunkedListT &chunkedList, size_t taskCount, Function function, Executor &executor);
+
+  /**
+   * @brief Calls the function with a reference to every element, with Chunks shared out between the executor's threads
+   */
+  template<typename T, size_t ChunkSize, typename Function, executor Executor = thread_pool>
+  void for_each(ChunkedList<T, ChunkSize> &chunkedList, Function function,
+                Executor &executor = thread_pool::global());
+
+  /**
+   * @brief Replaces every element with the result of calling the operation on it, in parallel
+   */
+  template<typename T, size_t ChunkSize, typename UnaryOperation, executor Executor = thread_pool>
+  void transform(ChunkedList<T, ChunkSize> &chunkedList, UnaryOperation operation,
+                 Executor &executor = thread_pool::global());
+
+  /**
+   * @brief Combines every element with the initial value through the operation, in parallel. Like std::reduce, the
+   * operation must be associative and commutative, as the elements are combined in an unspecified order
+   * @return The initial value combined with every element
+   */
+  template<typename T, size_t ChunkSize, typename ResultT, typename BinaryOperation = std::plus<>,
+    executor Executor = thread_pool>
+  ResultT reduce(const ChunkedList<T, ChunkSize> &chunkedList, ResultT init, BinaryOperation operation = {},
+                 Executor &executor = thread_pool::global());
+
+  /**
+   * @brief Counts the elements which satisfy the predicate, in parallel
+   * @return The number of elements the predicate returns true for
+   */
+  template<typename T, size_t ChunkSize, typename Predicate, executor Executor = thread_pool>
+  size_t count_if(const ChunkedList<T, ChunkSize> &chunkedList, Predicate predicate,
+                  Executor &executor = thread_pool::global());
+
+  /**
+   * @brief Stably sorts the ChunkedList, merge sorting the Chunks of each task in parallel and then merging the
+   * tasks' runs pairwise in parallel
+   */
+  template<typename Compare = std::less<>, typename T, size_t ChunkSize, executor Executor = thread_pool>
+  void sort(ChunkedList<T, ChunkSize> &chunkedList, Executor &executor = thread_pool::global());
+}
+
+#include "../src/ChunkedListParallel.tpp"
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "ChunkedList.hpp"
+
+#if defined(__GNUC__)
+#define CHUNKED_LIST_SIMD_VECTORS 1
+#define CHUNKED_LIST_SIMD_INLINE __attribute__((always_inline))
+#else
+#define CHUNKED_LIST_SIMD_VECTORS 0
+#define CHUNKED_LIST_SIMD_INLINE
+#endif
+
+#if CHUNKED_LIST_SIMD_VECTORS && (defined(__x86_64__) || defined(__i386__))
+#define CHUNKED_LIST_SIMD_X86 1
+#else
+#define CHUNKED_LIST_SIMD_X86 0
+#endif
+
+
+namespace chunked_list_utility::simd {
+  /**
+   * @brief The instruction sets the kernels can run with, which are chosen at runtime from those the CPU supports
+   */
+  enum InstructionSet {
+    /**
+     * @brief Plain loops over each Chunk's elements
+     */
+    Scalar,
+    /**
+     * @brief 16-byte vectors, which are SSE2 on x86 and the native 16-byte vectors on other architectures
+     */
+    SSE2,
+    /**
+     * @brief 32-byte vectors, only on x86 CPUs supporting AVX2
+     */
+    AVX2,
+  };
+
+  /**
+   * @brief The element types the kernels can process
+   */
+  template<typename T>
+  concept simd_element = (std::integral<T> && !std::same_as<T, bool>)
+                         || (std::floating_point<T> && (sizeof(T) == 4 || sizeof(T) == 8));
+
+  /**
+   * @brief The type sum and dot return, which is 64 bits wide for integers so that small integers don't overflow
+   */
+  template<simd_element T>
+  using sum_t = std::conditional_t<std::floating_point<T>, T,
+    std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t> >;
+
+  /**
+   * @brief The containers the counting and aggregating kernels can process: a ChunkedList, or any other chunked_range
+   * of kernel elements, such as a column of a ChunkedSoA
+   */
+  template<typename ChunkedRangeT>
+  concept simd_range = segmented::chunked_range<ChunkedRangeT>
+                       && simd_element<std::ranges::range_value_t<ChunkedRangeT> >;
+
+  /**
+   * @brief Returns the widest instruction set which both the CPU and the compiler support
+   */
+  InstructionSet supported_instruction_set();
+
+  /**
+   * @brief Returns the instruction set the kernels currently run with
+   */
+  InstructionSet instruction_set();
+
+  /**
+   * @brief Sets the instruction set the kernels run with, limited to the supported instruction set, which allows the
+   * kernels to be compared with each other
+   */
+  void set_instruction_set(InstructionSet instructionSet);
+
+  namespace kernels {
+    /**
+     * @brief Kernels over a single array, processing Bytes bytes of elements at a time, or one element at a time if
+     * Bytes is 0
+     */
+    template<size_t Bytes, typename T>
+    CHUNKED_LIST_SIMD_INLINE size_t find(const T *data, size_t count, T value);
+
+    template<size_t Bytes, typename T>
+    CHUNKED_LIST_SIMD_INLINE size_t count(const T *data, size_t count, T value);
+
+    template<size_t Bytes, typename T>
+    CHUNKED_LIST_SIMD_INLINE void minmax(const T *data, size_t count, T &min, T &max);
+
+    template<size_t Bytes, typename T>
+    CHUNKED_LIST_SIMD_INLINE sum_t<T> sum(const T *data, size_t count);
+
+    template<size_t Bytes, typename T>
+    CHUNKED_LIST_SIMD_INLINE sum_t<T> dot(const T *lhs, const T *rhs, size_t count);
+  }
+
+#if CHUNKED_LIST_SIMD_X86
+  /**
+   * @brief Calls the operation's call operator with a vector width of 32 bytes, compiled for AVX2
+   */
+  template<typename Operation>
+  __attribute__((target("avx2"))) decltype(auto) dispatch_avx2(Operation &operation);
+#endif
+
+  /**
+   * @brief Calls the operation's call operator with the vector width, in bytes, of the current instruction set. The
+   * operation and the kernels it calls are inlined into the call, so that they are compiled for that instruction set
+   */
+  template<typename Operation>
+  decltype(auto) dispatch(Operation &operation);
+
+  /**
+   * @brief Calls the function with the element array and size of every non-empty Chunk, passing the ChunkSize as a
+   * constant for full Chunks so that only partially filled Chunks take a variable length
+   */
+  template<typename T, size_t ChunkSize, typename Function>
+  CHUNKED_LIST_SIMD_INLINE void for_each_array(const ChunkedList<T, ChunkSize> &chunkedList, Function &&function);
+
+  /**
+   * @brief Calls the function with the element array and size of every non-empty span of any other chunked_range
+   */
+  template<segmented::chunked_range ChunkedRangeT, typename Function>
+  CHUNKED_LIST_SIMD_INLINE void for_each_array(const ChunkedRangeT &chunkedRange, Function &&function);
+
+  /**
+   * @brief Finds the first element equal to the value in a const or non-const ChunkedList
+   */
+  template<typename ChunkedListT, typename T>
+  auto find_element(ChunkedListT &chunkedList, T value) -> decltype(chunkedList.end());
+
+  /**
+   * @brief Finds the first element equal to the value
+   * @return An Iterator to the first element equal to the value, or the end Iterator if there is none
+   */
+  template<simd_element T, size_t ChunkSize>
+  typename ChunkedList<T, ChunkSize>::Iterator find(ChunkedList<T, ChunkSize> &chunkedList, std::type_identity_t<T> value);
+
+  /**
+   * @brief Finds the first element equal to the value
+   * @return A ConstIterator to the first element equal to the value, or the end ConstIterator if there is none
+   */
+  template<simd_element T, size_t ChunkSize>
+  typename ChunkedList<T, ChunkSize>::ConstIterator find(const ChunkedList<T, ChunkSize> &chunkedList, std::type_identity_t<T> value);
+
+  /**
+   * @return The number of elements equal to the value
+   */
+  template<simd_range ChunkedRangeT>
+  size_t count(const ChunkedRangeT &chunkedRange, std::ranges::range_value_t<ChunkedRangeT> value);
+
+  /**
+   * @return True if an element is equal to the value, otherwise false
+   */
+  template<simd_element T, size_t ChunkSize>
+  bool contains(const ChunkedList<T, ChunkSize> &chunkedList, std::type_identity_t<T> value);
+
+  /**
+   * @return The smallest element of the ChunkedList or chunked_range, which must not be empty
+   */
+  template<simd_range ChunkedRangeT>
+  std::ranges::range_value_t<ChunkedRangeT> min(const ChunkedRangeT &chunkedRange);
+
+  /**
+   * @return The largest element of the ChunkedList or chunked_range, which must not be empty
+   */
+  template<simd_range ChunkedRangeT>
+  std::ranges::range_value_t<ChunkedRangeT> max(const ChunkedRangeT &chunkedRange);
+
+  /**
+   * @return The smallest and largest elements of the ChunkedList or chunked_range, which must not be empty
+   */
+  template<simd_range ChunkedRangeT>
+  std::pair<std::ranges::range_value_t<ChunkedRangeT>, std::ranges::range_value_t<ChunkedRangeT> >
+  minmax(const ChunkedRangeT &chunkedRange);
+
+  /**
+   * @return The sum of every element. Floating-point elements are summed in a different order to a sequential loop,
+   * so the result can differ in its last bits
+   */
+  template<simd_range ChunkedRangeT>
+  sum_t<std::ranges::range_value_t<ChunkedRangeT> > sum(const ChunkedRangeT &chunkedRange);
+
+  /**
+   * @return The sum of the products of the elements at each index in both ChunkedLists, up to the shorter one's size
+   */
+  template<simd_element T, size_t ChunkSize>
+  sum_t<T> dot(const ChunkedList<T, ChunkSize> &lhs, const ChunkedList<T, ChunkSize> &rhs);
+}
+
+#include "../src/ChunkedListSimd.tpp"
@@ -17,8 +17,18 @@ class chunked_list final : ChunkedList<T, ChunkSize> {
 
     using const_iterator = typename derived_chunked_list::ConstIterator;
 
+    using chunk_span_range = typename derived_chunked_list::ChunkSpanRange;
+
+    using const_chunk_span_range = typename derived_chunked_list::ConstChunkSpanRange;
+
+    using snapshot_view = typename derived_chunked_list::Snapshot;
+
     using derived_chunked_list::operator[];
 
+    using derived_chunked_list::front;
+
+    using derived_chunked_list::back;
+
     using derived_chunked_list::begin;
 
     using derived_chunked_list::end;
@@ -31,10 +41,70 @@ class chunked_list final : ChunkedList<T, ChunkSize> {
 
     const_chunk_iterator end_chunk() const;
 
+    using derived_chunked_list::chunks;
+
     using derived_chunked_list::push;
 
     using derived_chunked_list::emplace;
 
+    /**
+     * @brief Pushes an element to the front of the chunked_list, in O(1) without moving any other element
+     */
+    void push_front(T value);
+
+    /**
+     * @brief Pushes an element to the front of the chunked_list, constructing it in place from the given arguments
+     * @return A reference to the constructed element
+     */
+    template<typename... Args>
+    T &emplace_front(Args &&... args);
+
+    using derived_chunked_list::append;
+
+    /**
+     * @brief Moves every element of the other chunked_list to the back of the given one by relinking the other's Chunks
+     */
+    void append(chunked_list &&other);
+
+    /**
+     * @brief Moves every element of the other chunked_list to the back of the given one by relinking the other's Chunks
+     */
+    void splice(chunked_list &&other);
+
+    /**
+     * @brief Exchanges the Chunks of the given chunked_list with the other's, without copying or moving any elements
+     */
+    void swap(chunked_list &other) noexcept;
+
+    using derived_chunked_list::reserve;
+
+    using derived_chunked_list::resize;
+
+    using derived_chunked_list::capacity;
+
+    using derived_chunked_list::stats;
+
+#ifdef CHUNKED_LIST_COUNTERS
+    using derived_chunked_list::counters;
+
+    /**
+     * @brief Sets every counter of chunked_list<T, ChunkSize> back to 0
+     */
+    static void reset_counters();
+#endif
+
+    using derived_chunked_list::insert;
+
+    using derived_chunked_list::erase;
+
+    /**
+     * @brief Erases every element which satisfies the predicate in a single pass, returning the number erased
+     */
+    template<std::predicate<const T &> Predicate>
+    size_t erase_if(Predicate predicate);
+
+    using derived_chunked_list::retain;
+
     using derived_chunked_list::pop;
 
     /**
@@ -42,6 +112,30 @@ class chunked_list final : ChunkedList<T, ChunkSize> {
      */
     void pop_chunk();
 
+    /**
+     * @brief Pops and destroys the first element, releasing the front Chunk once it is emptied
+     */
+    void pop_front();
+
+    /**
+     * @brief Pops and destroys the given number of elements from the front of the chunked_list
+     */
+    void pop_front(size_t count);
+
+    /**
+     * @brief Sets how many popped Chunks are kept for reuse by later pushes instead of being deallocated
+     */
+    void set_retention_policy(RetentionPolicy policy, size_t limit);
+
+    /**
+     * @brief Deallocates every spare Chunk kept for reuse
+     */
+    void shrink_to_fit();
+
+    using derived_chunked_list::slab;
+
+    using derived_chunked_list::snapshot;
+
     using derived_chunked_list::sort;
 
     using derived_chunked_list::size;
@@ -52,10 +146,51 @@ class chunked_list final : ChunkedList<T, ChunkSize> {
 
     bool operator!=(const chunked_list &other) const;
 
+    using derived_chunked_list::save;
+
+    /**
+     * @brief Returns the number of characters format_to writes, counting the digits of integers without formatting them
+     */
+    size_t formatted_size(std::string_view delimiter = ", ") const
+      requires chunked_list_utility::formatting::to_chars_formattable<T>;
+
+    /**
+     * @brief Formats the elements into the given buffer with std::to_chars, separated by the delimiter, without
+     * allocating. Floating-point elements are formatted in general form with a precision of 6
+     */
+    std::to_chars_result format_to(char *first, char *last, std::string_view delimiter = ", ") const
+      requires chunked_list_utility::formatting::to_chars_formattable<T>;
+
+    /**
+     * @brief Appends the elements to the string, formatted as by format_to and separated by the delimiter
+     */
+    void format_to(std::string &output, std::string_view delimiter = ", ") const
+      requires chunked_list_utility::formatting::to_chars_formattable<T>;
+
     using derived_chunked_list::concat;
+};
 
-    template<typename, size_t, bool>
-    friend std::ostream &operator<<(std::ostream &os, chunked_list &chunkedList);
+/**
+ * @brief Inserts the chunked_list to an ostream, as its elements separated by commas in square brackets
+ */
+template<typename T, size_t ChunkSize>
+std::ostream &operator<<(std::ostream &os, const chunked_list<T, ChunkSize> &chunkedList);
+
+#ifdef __cpp_lib_format
+/**
+ * @brief Formats a chunked_list with std::format like a ChunkedList
+ */
+template<typename T, size_t ChunkSize>
+struct std::formatter<chunked_list<T, ChunkSize>, char> : std::formatter<ChunkedList<T, ChunkSize>, char> {
+  template<typename FormatContext>
+  typename FormatContext::iterator format(const chunked_list<T, ChunkSize> &chunkedList, FormatContext &ctx) const;
 };
+#endif
+
+/**
+ * @brief Exchanges the Chunks of two chunked_lists
+ */
+template<typename T, size_t ChunkSize>
+void swap(chunked_list<T, ChunkSize> &lhs, chunked_list<T, ChunkSize> &rhs) noexcept;
 
 #include "../src/ChunkedListSnake.tpp"
@@ -0,0 +1,394 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ChunkedList.hpp"
+
+/**
+ * @class ChunkedSoA
+ * @brief A structure-of-arrays sibling of ChunkedList, storing records of several fields in fixed-size Chunks which
+ * hold one contiguous array per field.
+ *
+ * A scan over one field only reads that field's arrays, instead of pulling every field of each record through the
+ * cache. Each column can be visited a Chunk at a time like a ChunkedList, so the segmented algorithms and SIMD kernels
+ * of chunked_list_utility run over a single column. Records are accessed through proxy references, which are tuples of
+ * references to each of their fields.
+ *
+ * @tparam ChunkSize The number of records in each Chunk
+ * @tparam Fields The types of the fields of each record
+ */
+template<size_t ChunkSize, typename... Fields>
+class ChunkedSoA {
+  static_assert(ChunkSize > 0, "Chunk Size must be greater than 0");
+  static_assert(sizeof...(Fields) > 0, "A ChunkedSoA needs at least one field");
+
+  public:
+    /**
+     * @brief The type of the field at the given index
+     */
+    template<size_t Index>
+    using FieldType = std::tuple_element_t<Index, std::tuple<Fields...> >;
+
+  private:
+    /**
+     * @brief Uninitialised storage for one field of ChunkSize records
+     */
+    template<typename Field>
+    class FieldArray {
+      alignas(Field) std::byte data[sizeof(Field) * ChunkSize];
+
+      public:
+        /**
+         * @brief Returns the address of the storage for the field at the given index, whether constructed or not
+         */
+        Field *slot(size_t index);
+
+        Field &operator[](size_t index);
+
+        const Field &operator[](size_t index) const;
+    };
+
+    class Chunk {
+      std::tuple<FieldArray<Fields>...> arrays{};
+
+      public:
+        Chunk() = default;
+
+        Chunk(const Chunk &) = delete;
+
+        Chunk &operator=(const Chunk &) = delete;
+
+        /**
+         * @brief Destroys every constructed record in the Chunk
+         */
+        ~Chunk();
+
+        size_t nextIndex{0};
+
+        template<size_t Index>
+        FieldArray<FieldType<Index> > &array();
+
+        template<size_t Index>
+        const FieldArray<FieldType<Index> > &array() const;
+
+        /**
+         * @brief Constructs each field of a record at the next index from the corresponding argument. If a field's
+         * constructor throws, the fields already constructed are destroyed and the Chunk is left unchanged
+         */
+        template<typename... Args>
+        void emplace(Args &&... args);
+
+        /**
+         * @brief Destroys the record before the next index
+         */
+        void pop();
+
+        /**
+         * @brief Destroys every constructed record in the Chunk
+         */
+        void clear();
+    };
+
+    /**
+     * @brief The Chunks in order. Records are only pushed and popped at the back, so every Chunk but the back one is
+     * full, and a record is found in O(1) from its index
+     */
+    std::vector<Chunk *> chunkDirectory{};
+
+    size_t elementCount{0};
+
+    /**
+     * @brief The most recently emptied Chunk, kept so that pushing and popping around a Chunk boundary doesn't allocate
+     */
+    Chunk *spareChunk{nullptr};
+
+    /**
+     * @brief Returns the Chunk holding the record at the given index, along with the record's index within it
+     */
+    std::pair<Chunk *, size_t> locate(size_t index) const;
+
+    /**
+     * @brief Applies the given order of record indices to every field, moving each record once into a buffer and back
+     */
+    void permute(const std::vector<size_t> &order);
+
+  public:
+    /**
+     * @brief A record's fields by value
+     */
+    using value_type = std::tuple<Fields...>;
+
+    /**
+     * @brief A proxy reference to a record, through which its fields can be read and assigned
+     */
+    using Reference = std::tuple<Fields &...>;
+
+    /**
+     * @brief A proxy reference to a record, through which its fields can only be read
+     */
+    using ConstReference = std::tuple<const Fields &...>;
+
+    /**
+     * @brief A random access iterator over the records, or over one field of each record, dereferencing to whatever
+     * the Access class returns for the ChunkedSoA and an index
+     */
+    template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+    class GenericIterator {
+      SoAT *soa{nullptr};
+      size_t index{0};
+
+      public:
+        // stl compatibility
+        using value_type = ValueT;
+        using difference_type = std::ptrdiff_t;
+        using reference = ReferenceT;
+        using iterator_category = std::conditional_t<std::is_reference_v<ReferenceT>, std::random_access_iterator_tag,
+          std::input_iterator_tag>;
+        using iterator_concept = std::random_access_iterator_tag;
+
+        GenericIterator() = default;
+
+        GenericIterator(SoAT *soa, size_t index);
+
+        ReferenceT operator*() const;
+
+        ReferenceT operator[](difference_type offset) const;
+
+        GenericIterator &operator++();
+
+        GenericIterator operator++(int);
+
+        GenericIterator &operator--();
+
+        GenericIterator operator--(int);
+
+        GenericIterator &operator+=(difference_type offset);
+
+        GenericIterator &operator-=(difference_type offset);
+
+        GenericIterator operator+(difference_type offset) const;
+
+        GenericIterator operator-(difference_type offset) const;
+
+        friend GenericIterator operator+(const difference_type offset, const GenericIterator &iterator) {
+          return iterator + offset;
+        }
+
+        difference_type operator-(const GenericIterator &other) const;
+
+        bool operator==(const GenericIterator &other) const;
+
+        std::strong_ordering operator<=>(const GenericIterator &other) const;
+
+        /**
+         * @brief Returns the index of the record the iterator points to
+         */
+        size_t getIndex() const;
+    };
+
+  private:
+    template<typename SoAT>
+    struct RecordAccess {
+      decltype(auto) operator()(SoAT &soa, size_t index) const;
+    };
+
+    template<size_t Index, typename SoAT>
+    struct FieldAccess {
+      decltype(auto) operator()(SoAT &soa, size_t index) const;
+    };
+
+    /**
+     * @brief Returns one field's array in the given Chunk as a std::span over its constructed elements
+     */
+    template<size_t Index, typename SoAT>
+    struct ChunkSpan {
+      SoAT *soa{nullptr};
+
+      auto operator()(size_t chunk) const;
+    };
+
+  public:
+    using Iterator = GenericIterator<ChunkedSoA, value_type, Reference, RecordAccess<ChunkedSoA> >;
+
+    using ConstIterator = GenericIterator<const ChunkedSoA, value_type, ConstReference, RecordAccess<const ChunkedSoA> >;
+
+    /**
+     * @brief A view of one field of every record, which is a sized random access range of the field, and can be
+     * visited a Chunk at a time through chunks, like a ChunkedList
+     */
+    template<size_t Index, typename SoAT>
+    class GenericColumn {
+      using FieldT = std::conditional_t<std::is_const_v<SoAT>, const FieldType<Index>, FieldType<Index> >;
+
+      SoAT *soa{nullptr};
+
+      public:
+        using ColumnIterator = GenericIterator<SoAT, FieldType<Index>, FieldT &, FieldAccess<Index, SoAT> >;
+
+        /**
+         * @brief A random access view of a std::span over the field's array in each Chunk
+         */
+        using ChunkSpanRange = std::ranges::transform_view<std::ranges::iota_view<size_t, size_t>,
+          ChunkSpan<Index, SoAT> >;
+
+        GenericColumn() = default;
+
+        explicit GenericColumn(SoAT *soa);
+
+        ColumnIterator begin() const;
+
+        ColumnIterator end() const;
+
+        FieldT &operator[](size_t index) const;
+
+        size_t size() const;
+
+        bool empty() const;
+
+        /**
+         * @brief Returns a view of the field as a span over each Chunk's array, which the segmented algorithms and the
+         * SIMD kernels of chunked_list_utility work through
+         */
+        ChunkSpanRange chunks() const;
+    };
+
+    template<size_t Index>
+    using Column = GenericColumn<Index, ChunkedSoA>;
+
+    template<size_t Index>
+    using ConstColumn = GenericColumn<Index, const ChunkedSoA>;
+
+    /**
+     * @brief The default constructor for ChunkedSoA, which allocates nothing until the first record is pushed
+     */
+    ChunkedSoA() = default;
+
+    /**
+     * @brief Copies every record of the other ChunkedSoA into new Chunks
+     */
+    ChunkedSoA(const ChunkedSoA &other);
+
+    /**
+     * @brief Takes the Chunks of the other ChunkedSoA, leaving it empty
+     */
+    ChunkedSoA(ChunkedSoA &&other) noexcept;
+
+    ChunkedSoA &operator=(const ChunkedSoA &other);
+
+    ChunkedSoA &operator=(ChunkedSoA &&other) noexcept;
+
+    /**
+     * @brief Destroys every record and deallocates every Chunk
+     */
+    ~ChunkedSoA();
+
+    /**
+     * @brief Direct indexing into the records, of O(1) complexity
+     * @param index The index of the record
+     * @return A proxy reference to the record's fields
+     */
+    Reference operator[](size_t index);
+
+    /**
+     * @brief Direct indexing into the records, of O(1) complexity
+     * @param index The index of the record
+     * @return A const proxy reference to the record's fields
+     */
+    ConstReference operator[](size_t index) const;
+
+    /**
+     * @return A proxy reference to the first record, which must exist
+     */
+    Reference front();
+
+    /**
+     * @return A const proxy reference to the first record, which must exist
+     */
+    ConstReference front() const;
+
+    /**
+     * @return A proxy reference to the last record, which must exist
+     */
+    Reference back();
+
+    /**
+     * @return A const proxy reference to the last record, which must exist
+     */
+    ConstReference back() const;
+
+    Iterator begin();
+
+    ConstIterator begin() const;
+
+    Iterator end();
+
+    ConstIterator end() const;
+
+    /**
+     * @brief Returns a view of the field at the given index of every record
+     */
+    template<size_t Index>
+    Column<Index> column();
+
+    /**
+     * @brief Returns a const view of the field at the given index of every record
+     */
+    template<size_t Index>
+    ConstColumn<Index> column() const;
+
+    /**
+     * @brief Pushes a record to the back of the ChunkedSoA
+     * @param values The value of each field of the record
+     */
+    void push(Fields... values);
+
+    /**
+     * @brief Constructs a record in place at the back of the ChunkedSoA, each field from the corresponding argument
+     * @return A proxy reference to the constructed record
+     */
+    template<typename... Args> requires (sizeof...(Args) == sizeof...(Fields)
+                                         && (std::is_constructible_v<Fields, Args &&> && ...))
+    Reference emplace(Args &&... args);
+
+    /**
+     * @brief Pops and destroys the last record, if there is one
+     */
+    void pop();
+
+    /**
+     * @brief Destroys every record, keeping one Chunk for reuse
+     */
+    void clear();
+
+    /**
+     * @brief Sorts the records by the field at the given index, sorting the field's values along with their record
+     * indices through chunked_list_utility::sort, and then moving each field into the sorted order once
+     * @tparam Index The index of the field to sort by
+     * @tparam Compare The Compare class ordering the field's values
+     * @tparam Sort The sorting algorithm which should be used, which can be RadixSort for numeric fields
+     */
+    template<size_t Index, typename Compare = std::less<FieldType<Index> >,
+      chunked_list_utility::SortType Sort = chunked_list_utility::QuickSort>
+    void sortBy();
+
+    /**
+     * @brief Returns the number of records
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns whether the ChunkedSoA holds no records
+     */
+    bool empty() const;
+};
+
+#include "../src/ChunkedSoA.tpp"
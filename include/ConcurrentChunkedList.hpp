@@ -0,0 +1,198 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+
+/**
+ * @class ConcurrentChunkedList
+ * @brief An append-only linked list of fixed-size Chunks, which any number of threads can push to at once without locking.
+ *
+ * Producers reserve a slot with an atomic fetch-add on the back Chunk's fill counter, and link a new Chunk with a
+ * compare-exchange on the full Chunk's nextChunk once every slot has been reserved. Each slot has its own state, which
+ * is published after the element is constructed, so readers iterating concurrently only observe constructed elements.
+ *
+ * @tparam T The type of elements to be stored in the ConcurrentChunkedList
+ * @tparam ChunkSize The number of elements in each Chunk, with a default value of 32
+ */
+template<typename T, size_t ChunkSize = 32>
+class ConcurrentChunkedList {
+  static_assert(ChunkSize > 0, "Chunk Size must be greater than 0");
+
+  /**
+   * @brief The size of a cache line, which separates the counters that every producer writes to
+   */
+  static constexpr size_t CacheLineSize = 64;
+
+  enum SlotState : uint8_t {
+    /**
+     * @brief The slot has not been reserved, or its element is still being constructed
+     */
+    Unpublished,
+    /**
+     * @brief The slot's element is constructed and may be read
+     */
+    Published,
+    /**
+     * @brief The slot's element threw while being constructed, so readers skip the slot
+     */
+    Abandoned,
+  };
+
+  class Chunk {
+    /**
+     * @brief Uninitialised storage for ChunkSize elements, of which only the published slots are constructed
+     */
+    alignas(T) std::byte data[sizeof(T) * ChunkSize];
+
+    public:
+      Chunk() = default;
+
+      Chunk(const Chunk &) = delete;
+
+      Chunk &operator=(const Chunk &) = delete;
+
+      /**
+       * @brief Destroys every published element in the Chunk
+       */
+      ~Chunk();
+
+      /**
+       * @brief The number of slots which have been reserved, which exceeds ChunkSize once producers have overflowed
+       * into the next Chunk
+       */
+      alignas(CacheLineSize) std::atomic<size_t> reserved{0};
+
+      std::atomic<SlotState> states[ChunkSize]{};
+
+      std::atomic<Chunk *> nextChunk{nullptr};
+
+      /**
+       * @brief Returns the address of the storage for the element at the given index, whether constructed or not
+       */
+      T *slot(size_t index);
+
+      const T &operator[](size_t index) const;
+  };
+
+  Chunk *front;
+
+  /**
+   * @brief The Chunk which producers reserve slots in, which lags behind the last linked Chunk only while a producer
+   * is moving it forwards
+   */
+  alignas(CacheLineSize) std::atomic<Chunk *> back;
+
+  /**
+   * @brief The number of published elements
+   */
+  alignas(CacheLineSize) std::atomic<size_t> elementCount{0};
+
+  /**
+   * @brief Returns the Chunk after the given full Chunk, linking a new one if no other producer has yet, and moves
+   * the back Chunk forwards to it
+   */
+  Chunk *advanceChunk(Chunk *chunk);
+
+  public:
+    /**
+     * @brief The iterator end sentinel, which an iterator reaches at the first slot that hasn't been published yet
+     */
+    struct Sentinel {};
+
+    /**
+     * @brief A forward iterator over the published elements, in the order their slots were reserved
+     */
+    class ConstIterator {
+      const Chunk *chunk{nullptr};
+      size_t index{0};
+
+      /**
+       * @brief Moves forwards past any abandoned slots, and onto the next Chunk at the end of a Chunk
+       */
+      void skipUnreadable();
+
+      public:
+        // stl compatibility
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+        using iterator_category = std::forward_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+
+        ConstIterator() = default;
+
+        explicit ConstIterator(const Chunk *chunkPtr, size_t index = 0);
+
+        ConstIterator &operator++();
+
+        ConstIterator operator++(int);
+
+        const T &operator*() const;
+
+        const T *operator->() const;
+
+        bool operator==(const ConstIterator &other) const;
+
+        /**
+         * @return True if the iterator has reached a slot whose element hasn't been published yet
+         */
+        bool operator==(Sentinel) const;
+    };
+
+    /**
+     * @brief The default constructor for ConcurrentChunkedList, allocating a single Chunk for the front and back
+     */
+    ConcurrentChunkedList();
+
+    ConcurrentChunkedList(const ConcurrentChunkedList &) = delete;
+
+    ConcurrentChunkedList &operator=(const ConcurrentChunkedList &) = delete;
+
+    /**
+     * @brief Destroys every element and deallocates every Chunk, which must not happen while any thread is still
+     * pushing or iterating
+     */
+    ~ConcurrentChunkedList();
+
+    /**
+     * @brief Pushes an element to the back of the ConcurrentChunkedList, and may be called from any number of threads
+     * at once
+     * @param value The element which will be pushed to the back of the container
+     */
+    void push(T value);
+
+    /**
+     * @brief Constructs an element in place at the back of the ConcurrentChunkedList, and may be called from any number
+     * of threads at once. If the constructor throws, the reserved slot is skipped by readers
+     * @return A reference to the constructed element
+     */
+    template<typename... Args>
+    T &emplace(Args &&... args);
+
+    /**
+     * @brief Returns a ConstIterator to the first published element
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @brief Returns the Sentinel which iteration stops at, which is the first slot that hasn't been published yet.
+     * Elements pushed concurrently may or may not be reached, but every element reached is fully constructed
+     */
+    Sentinel end() const;
+
+    /**
+     * @brief Returns the number of published elements, which may be behind pushes still in progress
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns whether no element has been published yet
+     */
+    bool empty() const;
+};
+
+#include "../src/ConcurrentChunkedList.tpp"
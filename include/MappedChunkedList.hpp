@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include "ChunkedList.hpp"
+
+/**
+ * @class MappedChunkedList
+ * @brief A read-only view of a snapshot saved by ChunkedList::save, which memory-maps the file instead of reading it.
+ *
+ * Opening a snapshot only checks its header, so it takes the same time however many elements were saved, and the
+ * elements are paged in by the operating system as they are first accessed. The elements are stored contiguously in
+ * the snapshot, so indexing is O(1) whichever Chunks they were saved from.
+ *
+ * @tparam T The type of elements stored in the snapshot, which must be trivially copyable
+ * @tparam ChunkSize The ChunkSize of the ChunkedList which saved the snapshot, with a default value of 32
+ */
+template<typename T, size_t ChunkSize = 32>
+class MappedChunkedList {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be memory-mapped");
+
+  /**
+   * @brief Splits the mapped elements into spans of ChunkSize elements, of which only the last can be shorter
+   */
+  struct ChunkSpan {
+    const T *elements{nullptr};
+    size_t elementCount{0};
+
+    std::span<const T> operator()(size_t chunk) const;
+  };
+
+  void *mapping{nullptr};
+
+  size_t mappingSize{0};
+
+  const T *elements{nullptr};
+
+  size_t elementCount{0};
+
+  uint64_t savedChecksum{0};
+
+  /**
+   * @brief Unmaps the file, if one is mapped
+   */
+  void unmap();
+
+  public:
+    using ConstIterator = const T *;
+
+    /**
+     * @brief A random access view of a std::span over each ChunkSize elements of the snapshot
+     */
+    using ConstChunkSpanRange = std::ranges::transform_view<std::ranges::iota_view<size_t, size_t>, ChunkSpan>;
+
+    /**
+     * @brief Maps the snapshot file at the given path
+     * @param path The path of a file written by ChunkedList<T, ChunkSize>::save
+     * @throws std::system_error If the file can't be opened or mapped
+     * @throws std::runtime_error If the file isn't a snapshot of a ChunkedList<T, ChunkSize> saved on a machine with
+     * the same byte order, or is shorter than its header says
+     */
+    explicit MappedChunkedList(const std::filesystem::path &path);
+
+    MappedChunkedList(const MappedChunkedList &) = delete;
+
+    MappedChunkedList &operator=(const MappedChunkedList &) = delete;
+
+    MappedChunkedList(MappedChunkedList &&other) noexcept;
+
+    MappedChunkedList &operator=(MappedChunkedList &&other) noexcept;
+
+    /**
+     * @brief Unmaps the file, after which no reference to its elements may be used
+     */
+    ~MappedChunkedList();
+
+    /**
+     * @brief Direct indexing into the mapped elements, of O(1) complexity
+     * @param index The index of the element in the snapshot
+     * @return A const reference to the value at the index
+     */
+    const T &operator[](size_t index) const;
+
+    /**
+     * @return A const reference to the first element, which must exist
+     */
+    const T &front() const;
+
+    /**
+     * @return A const reference to the last element, which must exist
+     */
+    const T &back() const;
+
+    /**
+     * @brief Returns a ConstIterator to the first element
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @brief Returns a ConstIterator to the element after the last
+     */
+    ConstIterator end() const;
+
+    /**
+     * @brief Returns a view of the elements as spans of ChunkSize elements, so that the segmented algorithms can be
+     * used on a MappedChunkedList as on a ChunkedList
+     */
+    ConstChunkSpanRange chunks() const;
+
+    /**
+     * @brief Returns the number of elements in the snapshot
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns whether the snapshot holds no elements
+     */
+    bool empty() const;
+
+    /**
+     * @brief Recomputes the checksum of the elements, reading every page of the file
+     * @return True if it matches the checksum saved in the header, otherwise false
+     */
+    bool verify() const;
+};
+
+#include "../src/MappedChunkedList.tpp"
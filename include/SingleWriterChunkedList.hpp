@@ -0,0 +1,353 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @class SingleWriterChunkedList
+ * @brief A linked list of fixed-size Chunks, which one thread pushes to and pops from while any number of threads
+ * iterate over it without locking.
+ *
+ * Each slot of a Chunk is constructed once and left untouched until the Chunk is deallocated, and the writer publishes
+ * every constructed slot and the element count with release stores, so a reader only ever observes constructed
+ * elements. Popping only unpublishes elements: pushing into a popped slot replaces the back Chunk with a copy instead,
+ * and the Chunks which are unlinked are reclaimed through epochs once no reader can still reach them.
+ *
+ * @tparam T The type of elements to be stored in the SingleWriterChunkedList
+ * @tparam ChunkSize The number of elements in each Chunk, with a default value of 32
+ */
+template<typename T, size_t ChunkSize = 32>
+class SingleWriterChunkedList {
+  static_assert(ChunkSize > 0, "Chunk Size must be greater than 0");
+
+  /**
+   * @brief The size of a cache line, which separates the counters written by the writer from those written by readers
+   */
+  static constexpr size_t CacheLineSize = 64;
+
+  class Chunk {
+    /**
+     * @brief Uninitialised storage for ChunkSize elements, of which only the constructed slots hold an element
+     */
+    alignas(T) std::byte data[sizeof(T) * ChunkSize];
+
+    public:
+      Chunk() = default;
+
+      Chunk(const Chunk &) = delete;
+
+      Chunk &operator=(const Chunk &) = delete;
+
+      /**
+       * @brief Destroys every constructed element in the Chunk, popped ones included
+       */
+      ~Chunk();
+
+      /**
+       * @brief The number of constructed slots, which readers load with acquire semantics and which never decreases,
+       * as popping leaves the popped elements constructed
+       */
+      std::atomic<size_t> constructedCount{0};
+
+      std::atomic<Chunk *> nextChunk{nullptr};
+
+      /**
+       * @brief The previous Chunk, which only the writer reads
+       */
+      Chunk *prevChunk{nullptr};
+
+      /**
+       * @brief Returns the address of the storage for the element at the given index, whether constructed or not
+       */
+      T *slot(size_t index);
+
+      const T &operator[](size_t index) const;
+  };
+
+  /**
+   * @brief The reading epoch of a Reader, which is registered once and reused after its Reader is destroyed
+   */
+  struct alignas(CacheLineSize) ReaderRecord {
+    /**
+     * @brief The global epoch when the Reader's current View was created, or 0 while it has no View
+     */
+    std::atomic<size_t> epoch{0};
+
+    std::atomic<bool> claimed{true};
+
+    ReaderRecord *nextRecord{nullptr};
+  };
+
+  /**
+   * @brief A Chunk which has been unlinked, with the global epoch it was unlinked in
+   */
+  struct RetiredChunk {
+    Chunk *chunk;
+    size_t epoch;
+  };
+
+  std::atomic<Chunk *> frontChunk;
+
+  /**
+   * @brief The Chunk which the writer pushes to, which only the writer reads
+   */
+  Chunk *backChunk;
+
+  /**
+   * @brief The number of elements in the back Chunk, which may be less than its constructed slots after popping, and
+   * which only the writer reads
+   */
+  size_t backIndex{0};
+
+  /**
+   * @brief The number of elements, which readers load with acquire semantics
+   */
+  alignas(CacheLineSize) std::atomic<size_t> elementCount{0};
+
+  /**
+   * @brief The global epoch, which the writer advances every time it unlinks a Chunk. It starts at 1, as an epoch of 0
+   * marks a Reader without a View
+   */
+  alignas(CacheLineSize) std::atomic<size_t> globalEpoch{1};
+
+  /**
+   * @brief The registered ReaderRecords, to which Readers on any thread prepend new ones with a compare-exchange
+   */
+  mutable std::atomic<ReaderRecord *> readerRecords{nullptr};
+
+  /**
+   * @brief The unlinked Chunks which a reader may still be reading, which only the writer accesses
+   */
+  std::vector<RetiredChunk> retiredChunks{};
+
+  /**
+   * @brief Links a new empty Chunk after the back Chunk, and makes it the back Chunk
+   */
+  void pushChunk();
+
+  /**
+   * @brief Replaces the back Chunk with a copy of its first elements, so that the slots after them can be constructed
+   * again, and retires the original
+   */
+  void replaceBack(size_t count);
+
+  /**
+   * @brief Hands an unlinked Chunk over to be deallocated once every View which may reach it has been destroyed
+   */
+  void retireChunk(Chunk *chunk);
+
+  /**
+   * @brief Deallocates the retired Chunks which were unlinked before the epoch of every current View
+   */
+  void reclaimChunks();
+
+  public:
+    class Reader;
+
+    /**
+     * @class View
+     * @brief The elements of a SingleWriterChunkedList up to its size when the View was created, which no Chunk that
+     * the View may reach is deallocated during. Creating and iterating a View is wait-free
+     */
+    class View {
+      friend class Reader;
+
+      ReaderRecord *record{nullptr};
+      const Chunk *frontChunk{nullptr};
+      size_t elementCount{0};
+
+      View(ReaderRecord *record, const SingleWriterChunkedList &list);
+
+      public:
+        /**
+         * @brief The iterator end sentinel, which an iterator reaches after the View's last element, or at the first
+         * slot that hasn't been constructed yet
+         */
+        struct Sentinel {};
+
+        /**
+         * @brief A forward iterator over the elements of a View
+         */
+        class ConstIterator {
+          const Chunk *chunk{nullptr};
+          size_t index{0};
+
+          /**
+           * @brief The constructed slots of the Chunk when they were last loaded, which are only loaded again once the
+           * index reaches them, so that iterating doesn't contend with the writer for each element
+           */
+          size_t available{0};
+
+          /**
+           * @brief The number of elements which the iterator can still reach, counting the current one
+           */
+          size_t remaining{0};
+
+          /**
+           * @brief Loads the constructed slots of the Chunk again once the index reaches them, moving onto the next
+           * Chunk at the end of a Chunk
+           */
+          void refresh();
+
+          public:
+            // stl compatibility
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T *;
+            using reference = const T &;
+            using iterator_category = std::forward_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+
+            ConstIterator() = default;
+
+            ConstIterator(const Chunk *chunkPtr, size_t remaining);
+
+            ConstIterator &operator++();
+
+            ConstIterator operator++(int);
+
+            const T &operator*() const;
+
+            const T *operator->() const;
+
+            bool operator==(const ConstIterator &other) const;
+
+            /**
+             * @return True if the iterator has passed the View's last element, or reached a slot which hasn't been
+             * constructed yet because elements were popped and pushed again since the View was created
+             */
+            bool operator==(Sentinel) const;
+        };
+
+        View(const View &) = delete;
+
+        View &operator=(const View &) = delete;
+
+        View(View &&other) noexcept;
+
+        /**
+         * @brief Ends the View, after which the Chunks it could reach may be deallocated
+         */
+        ~View();
+
+        /**
+         * @brief Returns a ConstIterator to the first element
+         */
+        ConstIterator begin() const;
+
+        /**
+         * @brief Returns the Sentinel which iteration stops at
+         */
+        Sentinel end() const;
+
+        /**
+         * @brief Returns the number of elements when the View was created
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns whether there were no elements when the View was created
+         */
+        bool empty() const;
+    };
+
+    /**
+     * @class Reader
+     * @brief The registration of a reading thread, through which it creates Views. A Reader is used by one thread at
+     * a time, holds at most one View at once, and must be destroyed before the SingleWriterChunkedList
+     */
+    class Reader {
+      friend class SingleWriterChunkedList;
+
+      const SingleWriterChunkedList *list{nullptr};
+      ReaderRecord *record{nullptr};
+
+      Reader(const SingleWriterChunkedList &list, ReaderRecord *record);
+
+      public:
+        Reader(const Reader &) = delete;
+
+        Reader &operator=(const Reader &) = delete;
+
+        Reader(Reader &&other) noexcept;
+
+        /**
+         * @brief Releases the Reader's registration, for the next Reader to reuse
+         */
+        ~Reader();
+
+        /**
+         * @brief Creates a View of the current elements, announcing the current epoch so that no Chunk the View can
+         * reach is deallocated before it is destroyed. Wait-free
+         */
+        View view() const;
+    };
+
+    /**
+     * @brief The default constructor for SingleWriterChunkedList, allocating a single Chunk for the front and back
+     */
+    SingleWriterChunkedList();
+
+    SingleWriterChunkedList(const SingleWriterChunkedList &) = delete;
+
+    SingleWriterChunkedList &operator=(const SingleWriterChunkedList &) = delete;
+
+    /**
+     * @brief Destroys every element and deallocates every Chunk, which must not happen while any Reader exists
+     */
+    ~SingleWriterChunkedList();
+
+    /**
+     * @brief Registers a Reader, reusing the registration of a destroyed one if there is one. May be called from any
+     * thread, and is lock-free
+     */
+    Reader reader() const;
+
+    /**
+     * @brief Pushes an element to the back of the SingleWriterChunkedList. Only the writer thread may push
+     * @param value The element which will be pushed to the back of the container
+     */
+    void push(T value);
+
+    /**
+     * @brief Constructs an element in place at the back of the SingleWriterChunkedList, publishing it once it is
+     * constructed. Only the writer thread may emplace
+     * @return A const reference to the constructed element, which readers may be reading
+     */
+    template<typename... Args>
+    const T &emplace(Args &&... args);
+
+    /**
+     * @brief Pops the last element, which is destroyed once its Chunk is reclaimed, as readers may still be reading
+     * it. The next push into its slot copies the back Chunk. Only the writer thread may pop
+     */
+    void pop() requires std::is_copy_constructible_v<T>;
+
+    /**
+     * @brief Pops every element of the back Chunk, and retires the Chunk unless it is the only one. Only the writer
+     * thread may pop
+     */
+    void popChunk() requires std::is_copy_constructible_v<T>;
+
+    /**
+     * @return A const reference to the last element, which must exist. Only the writer thread may call back
+     */
+    const T &back() const;
+
+    /**
+     * @brief Returns the number of elements, which may be called from any thread
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns whether there are no elements, which may be called from any thread
+     */
+    bool empty() const;
+};
+
+#include "../src/SingleWriterChunkedList.tpp"
@@ -12,3 +12,9 @@
 #define DEBUG_LOG(value)
 #define DEBUG_EXECUTE(source)
 #endif
+
+#ifdef CHUNKED_LIST_COUNTERS
+#define COUNTER_ADD(counter, amount) ChunkedList<T, ChunkSize>::counterStorage.counter.fetch_add(amount, std::memory_order_relaxed);
+#else
+#define COUNTER_ADD(counter, amount)
+#endif
@@ -1,7 +1,18 @@
 #pragma once
 
 #include <type_traits>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ios>
+#include <limits>
+#include <locale>
+#include <string_view>
+#include <vector>
 
 template<typename T, size_t ChunkSize>
 class ChunkedList;
@@ -13,8 +24,142 @@ namespace chunked_list_utility {
     InsertionSort,
     QuickSort,
     HeapSort,
+    /**
+     * @brief A stable sort, sorting each Chunk in place as a run and then merging the runs through one scratch buffer
+     */
+    MergeSort,
+    /**
+     * @brief Quick sort with median-of-three pivots, falling back to heap sort once the recursion gets too deep
+     */
+    IntroSort,
+    /**
+     * @brief A least significant digit radix sort, only available for the element types and Compare classes satisfying
+     * radix_sortable
+     */
+    RadixSort,
   };
 
+  /**
+   * @brief Decides how many popped Chunks a ChunkedList keeps for reuse instead of deallocating them
+   */
+  enum RetentionPolicy {
+    /**
+     * @brief Keeps at most the given number of spare Chunks
+     */
+    KeepSpareChunks,
+    /**
+     * @brief Keeps spare Chunks while the total (live + spare) number of Chunks is at most the given high-water mark
+     */
+    KeepHighWaterMark,
+  };
+
+  /**
+   * @brief Decides which NUMA nodes the memory of a ChunkSlab is placed on, where the platform supports it
+   */
+  enum NumaPolicy {
+    /**
+     * @brief Leaves the placement to the thread's own policy, which is usually the node of the first thread to touch
+     * each page
+     */
+    DefaultNode,
+    /**
+     * @brief Places each page on the node of the thread which first touches it, whatever the thread's own policy is
+     */
+    LocalNode,
+    /**
+     * @brief Spreads the pages round-robin across every node the process may use
+     */
+    InterleaveNodes,
+    /**
+     * @brief Places every page on the given node
+     */
+    BindNode,
+  };
+
+  /**
+   * @brief The size of a page, which is the default byte budget of auto_size
+   */
+  inline constexpr size_t page_size = 4096;
+
+  /**
+   * @brief The bytes of a Chunk before its elements: its start index, next index, position and snapshot epoch, and the
+   * links to the next and previous Chunks
+   */
+  inline constexpr size_t chunk_header_size = 4 * sizeof(size_t) + 2 * sizeof(void *);
+
+  /**
+   * @brief The alignment of a Chunk's elements, which is the alignment of T, but at least that of the header
+   */
+  template<typename T>
+  inline constexpr size_t chunk_alignment = std::max(alignof(T), alignof(void *));
+
+  /**
+   * @brief Returns the size of a Chunk of the given number of elements: the header, padded to the alignment of the
+   * elements, followed by the elements, padded to the same alignment
+   */
+  template<typename T>
+  constexpr size_t chunk_bytes(const size_t chunkSize) {
+    constexpr auto roundUp = [](const size_t bytes) {
+      return (bytes + chunk_alignment<T> - 1) / chunk_alignment<T> * chunk_alignment<T>;
+    };
+
+    return roundUp(chunk_header_size) + roundUp(sizeof(T) * chunkSize);
+  }
+
+  /**
+   * @brief Returns the largest ChunkSize whose Chunk fits into the byte budget, or 1 if not even a single element fits
+   */
+  template<typename T, size_t TargetBytes>
+  constexpr size_t fitting_chunk_size() {
+    size_t chunkSize = TargetBytes / sizeof(T);
+
+    while (chunkSize > 1 && chunk_bytes<T>(chunkSize) > TargetBytes)
+      --chunkSize;
+
+    return std::max<size_t>(chunkSize, 1);
+  }
+
+  /**
+   * @brief A ChunkSize chosen from the size of T, so that each Chunk, header included, fits into TargetBytes, which
+   * should be a size class of the allocator such as a multiple of the cache line size or the page size. Used as
+   * ChunkedList<T, chunked_list_utility::auto_size<T>>
+   * @tparam T The type of elements stored in the ChunkedList
+   * @tparam TargetBytes The most bytes a Chunk should take up, with a default of the page size
+   */
+  template<typename T, size_t TargetBytes = page_size>
+  inline constexpr size_t auto_size = fitting_chunk_size<T, TargetBytes>();
+
+  /**
+   * @brief The size of a cache line, the unit in which traversals prefetch Chunks
+   */
+  inline constexpr size_t cache_line_size = 64;
+
+  /**
+   * @brief How far ahead of a traversal through a ChunkedList of T its Chunks are prefetched, so that the next Chunks
+   * are already in cache by the time the traversal hops to them. Specialise it to tune it for an element type
+   * @tparam T The type of elements stored in the ChunkedList
+   */
+  template<typename T>
+  struct prefetch_policy {
+    /**
+     * @brief How many Chunks after the one being entered the prefetched Chunk is, where 0 turns prefetching off
+     */
+    static constexpr size_t distance = 4;
+
+    /**
+     * @brief How many cache lines are prefetched from the start of the Chunk, the first of which holds its header, where
+     * 0 also turns prefetching off
+     */
+    static constexpr size_t lines = 4;
+  };
+
+  /**
+   * @brief Hints that the given number of cache lines from the address are about to be read, where the compiler has a
+   * prefetch builtin. It is always inlined, as GCC finds a function which only prefetches to have no effect, and drops
+   * calls to it
+   */
+  [[gnu::always_inline]] void prefetch(const void *address, size_t lines);
+
   template<template <typename...> typename TemplateT, typename T>
   class is_template_of {
     template<typename>
@@ -38,6 +183,43 @@ namespace chunked_list_utility {
   template<typename ChunkedListT, typename T>
   concept is_generic_chunk_iterator = template_of<ChunkedListT::template GenericChunkIterator, T>;
 
+  /**
+   * @brief A Compare class ordering elements by the key which the Projection class extracts from them, allowing elements
+   * which aren't numbers themselves to be sorted with RadixSort by a numeric key
+   */
+  template<typename Projection, typename Order = std::less<> >
+  class key_compare {
+    public:
+      using projection = Projection;
+      using order = Order;
+
+      template<typename T>
+      bool operator()(const T &lhs, const T &rhs) const {
+        return Order{}(Projection{}(lhs), Projection{}(rhs));
+      }
+  };
+
+  /**
+   * @brief The key types RadixSort can order by their bytes
+   */
+  template<typename Key>
+  concept radix_key = (std::integral<Key> && !std::same_as<Key, bool>)
+                      || (std::floating_point<Key> && (sizeof(Key) == 4 || sizeof(Key) == 8));
+
+  template<typename Order, typename Key>
+  concept radix_order = std::same_as<Order, std::less<> > || std::same_as<Order, std::less<Key> >
+                        || std::same_as<Order, std::greater<> > || std::same_as<Order, std::greater<Key> >;
+
+  template<typename Compare, typename T>
+  concept radix_sortable = (radix_key<T> && radix_order<Compare, T>)
+                           || requires(const T &value)
+                           {
+                             requires template_of<key_compare, Compare>;
+                             requires radix_key<std::remove_cvref_t<decltype(typename Compare::projection{}(value))> >;
+                             requires radix_order<typename Compare::order,
+                                                  std::remove_cvref_t<decltype(typename Compare::projection{}(value))> >;
+                           };
+
   template<typename BaseOutputStream, typename OutputStream, typename T>
   concept can_insert = (std::is_base_of_v<BaseOutputStream, OutputStream>
                         || std::is_same_v<BaseOutputStream, OutputStream>)
@@ -68,6 +250,146 @@ namespace chunked_list_utility {
 
     template<typename Compare, typename T, size_t ChunkSize>
     void heap_sort(ChunkedList<T, ChunkSize> &chunkedList);
+
+    template<typename Compare, typename T, size_t ChunkSize>
+    void merge_sort(ChunkedList<T, ChunkSize> &chunkedList);
+
+    /**
+     * @brief Stably merges two adjacent sorted runs, moving the first run into the buffer
+     */
+    template<typename Compare, typename Iterator, typename T>
+    void merge_runs(Iterator first, Iterator middle, Iterator last, std::vector<T> &buffer);
+
+    /**
+     * @brief Stably merges adjacent sorted runs pairwise until one run is left, given the start of each run followed
+     * by the end of the last
+     */
+    template<typename Compare, typename Iterator, typename T>
+    void merge_run_list(std::vector<Iterator> &runs, std::vector<T> &buffer);
+
+    template<typename Compare, typename T, size_t ChunkSize> requires radix_sortable<Compare, T>
+    void radix_sort(ChunkedList<T, ChunkSize> &chunkedList);
+
+    /**
+     * @brief Maps a radix key to an unsigned integer whose bytes order the same way as the key
+     */
+    template<radix_key Key>
+    auto radix_bits(Key key);
+
+    template<typename Compare, typename T, size_t ChunkSize>
+    void intro_sort(typename ChunkedList<T, ChunkSize>::Iterator start,
+                    typename ChunkedList<T, ChunkSize>::Iterator end, size_t depthLimit);
+  }
+
+  namespace formatting {
+    /**
+     * @brief The element types formatted with std::to_chars, which excludes character types and bool so that they are
+     * still inserted as characters and booleans are
+     */
+    template<typename T>
+    concept to_chars_formattable = std::is_arithmetic_v<T> && !std::same_as<T, bool> && !std::same_as<T, char>
+                                   && !std::same_as<T, signed char> && !std::same_as<T, unsigned char>
+                                   && !std::same_as<T, wchar_t> && !std::same_as<T, char8_t>
+                                   && !std::same_as<T, char16_t> && !std::same_as<T, char32_t>;
+
+    /**
+     * @brief The precision floating-point elements are formatted with in general form unless a stream asks for
+     * another, which is a stream's default so that concat, formatTo and std::format write them as operator<< does
+     */
+    inline constexpr int default_precision = 6;
+
+    /**
+     * @brief The most characters format_element writes for any value of the type, given a precision of at most
+     * max_digits10 for floating-point types
+     */
+    template<to_chars_formattable T>
+    inline constexpr size_t max_chars = std::is_integral_v<T>
+                                          ? std::numeric_limits<T>::digits10 + 2
+                                          : std::numeric_limits<T>::max_digits10 + 12;
+
+    /**
+     * @brief Formats the value with std::to_chars, in general form with the given precision for floating-point types
+     * @param precision The number of significant digits of floating-point values, which integers ignore
+     */
+    template<to_chars_formattable T>
+    std::to_chars_result format_element(char *first, char *last, T value, int precision = default_precision);
+
+    /**
+     * @return The number of characters format_element writes for the value
+     */
+    template<to_chars_formattable T>
+    size_t formatted_size(T value);
+
+    /**
+     * @brief Formats the elements of the ChunkedList a Chunk at a time into a fixed buffer on the stack, calling the
+     * output with the buffer's contents as a std::string_view whenever it fills up and once at the end, so that
+     * formatting never allocates
+     * @param prefix Written before the first element
+     * @param delimiter Written between each element
+     * @param suffix Written after the last element
+     * @param precision The precision floating-point elements are formatted with, such as the precision of a stream
+     */
+    template<typename T, size_t ChunkSize, typename Output> requires to_chars_formattable<T>
+    void write_buffered(const ChunkedList<T, ChunkSize> &chunkedList, std::string_view prefix,
+                        std::string_view delimiter, std::string_view suffix, Output output,
+                        int precision = default_precision);
+
+    /**
+     * @return Whether the stream formats elements of the type as std::to_chars does, which holds while its flags, width
+     * and locale are at their defaults and, for floating-point types, its precision fits within max_chars
+     */
+    template<to_chars_formattable T>
+    bool formats_as_to_chars(const std::ios_base &stream);
+  }
+
+  namespace snapshot {
+    /**
+     * @brief The bytes every snapshot file starts with
+     */
+    inline constexpr std::array<char, 8> magic{'C', 'H', 'U', 'N', 'K', 'L', 'S', 'T'};
+
+    /**
+     * @brief The version of the snapshot format, which is raised whenever the layout changes
+     */
+    inline constexpr uint32_t version = 1;
+
+    /**
+     * @brief Written in the byte order of the machine which saved the snapshot, so that a machine of the other byte
+     * order rejects it
+     */
+    inline constexpr uint32_t byteOrderMark = 0x01020304;
+
+    /**
+     * @brief The header at the start of a snapshot file, which is followed by the elements of every Chunk in order as
+     * one contiguous array. The header is 64 bytes, so the elements are aligned for any type aligned to at most 64
+     */
+    struct header {
+      std::array<char, 8> magic;
+      uint32_t version;
+      uint32_t byteOrder;
+      uint64_t typeSize;
+      uint64_t typeAlignment;
+      uint64_t chunkSize;
+      uint64_t elementCount;
+      /**
+       * @brief The checksum of the element bytes
+       */
+      uint64_t checksum;
+      uint64_t reserved;
+    };
+
+    static_assert(sizeof(header) == 64 && std::is_trivially_copyable_v<header>);
+
+    /**
+     * @brief The initial value of checksum
+     */
+    inline constexpr uint64_t checksumSeed = 0xcbf29ce484222325;
+
+    /**
+     * @brief Continues an FNV-1a checksum over the given bytes, so that a payload can be checksummed in pieces
+     * @param seed The checksum of the bytes before these, or checksumSeed for the first piece
+     */
+    uint64_t checksum(const void *data, size_t size, uint64_t seed = checksumSeed);
   }
 }
 
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "ChunkSlab.hpp"
+
+#ifdef __linux__
+namespace chunked_list_utility::numa {
+  // the memory policy modes and flags of the mbind and get_mempolicy system calls, from linux/mempolicy.h, which are
+  // called directly so that libnuma isn't needed
+  inline constexpr int bindMode = 2;
+  inline constexpr int interleaveMode = 3;
+  inline constexpr int localMode = 4;
+  inline constexpr unsigned long allowedNodesFlag = 4;
+
+  /**
+   * @brief A node mask of up to 1024 nodes, which is the most the kernel supports
+   */
+  using node_mask = std::array<unsigned long, 1024 / (8 * sizeof(unsigned long))>;
+
+  /**
+   * @brief The number of nodes passed along with a node_mask, which the kernel expects to be one more than the number
+   * of bits in the mask
+   */
+  inline constexpr unsigned long maskNodes = 1024 + 1;
+}
+#endif
+
+inline ChunkSlab::ChunkSlab(const size_t blockSize, const size_t blockAlignment,
+                            const chunked_list_utility::NumaPolicy numaPolicy, const int numaNode)
+  : blockSize{std::max(blockSize, sizeof(FreeBlock))},
+    blockAlignment{blockAlignment},
+    numaPolicy{numaPolicy},
+    numaNode{numaNode} {
+  if (blockAlignment == 0 || (blockAlignment & (blockAlignment - 1)) != 0 || blockAlignment > 4096)
+    throw std::invalid_argument{"The block alignment of a ChunkSlab must be a power of 2 of at most 4096"};
+
+  this->blockSize = (this->blockSize + blockAlignment - 1) / blockAlignment * blockAlignment;
+
+  if (this->blockSize > slabSize)
+    throw std::invalid_argument{"The blocks of a ChunkSlab must fit into a slab"};
+
+  if (numaPolicy == chunked_list_utility::BindNode && (numaNode < 0 || numaNode >= 1024))
+    throw std::invalid_argument{"A ChunkSlab can only be bound to nodes 0 to 1023"};
+}
+
+inline ChunkSlab::~ChunkSlab() {
+  for (void *slab: slabs)
+    deallocateSlab(slab);
+}
+
+inline void *ChunkSlab::allocateSlab() const {
+#ifdef __linux__
+  namespace numa = chunked_list_utility::numa;
+
+  // twice the size is mapped, so that a slab aligned to the huge page size can be cut out of it
+  void *mapping = ::mmap(nullptr, slabSize * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+  if (mapping == MAP_FAILED)
+    throw std::system_error{errno, std::generic_category(), "Failed to map a Chunk slab"};
+
+  const auto mappingStart = reinterpret_cast<uintptr_t>(mapping);
+  const uintptr_t slabStart = (mappingStart + slabSize - 1) & ~(slabSize - 1);
+  const uintptr_t slabEnd = slabStart + slabSize;
+
+  if (slabStart != mappingStart)
+    ::munmap(mapping, slabStart - mappingStart);
+
+  if (slabEnd != mappingStart + slabSize * 2)
+    ::munmap(reinterpret_cast<void *>(slabEnd), mappingStart + slabSize * 2 - slabEnd);
+
+  void *slab = reinterpret_cast<void *>(slabStart);
+
+  // transparent huge pages may be disabled, in which case the slab is backed by normal pages
+  ::madvise(slab, slabSize, MADV_HUGEPAGE);
+
+  long result = 0;
+
+  if (numaPolicy == chunked_list_utility::LocalNode) {
+    result = ::syscall(SYS_mbind, slab, slabSize, numa::localMode, nullptr, 0UL, 0U);
+  } else if (numaPolicy == chunked_list_utility::InterleaveNodes) {
+    numa::node_mask nodes{};
+    result = ::syscall(SYS_get_mempolicy, nullptr, nodes.data(), numa::maskNodes, nullptr, numa::allowedNodesFlag);
+
+    if (result == 0)
+      result = ::syscall(SYS_mbind, slab, slabSize, numa::interleaveMode, nodes.data(), numa::maskNodes, 0U);
+  } else if (numaPolicy == chunked_list_utility::BindNode) {
+    constexpr size_t maskBits = 8 * sizeof(unsigned long);
+
+    numa::node_mask nodes{};
+    nodes[numaNode / maskBits] = 1UL << (numaNode % maskBits);
+    result = ::syscall(SYS_mbind, slab, slabSize, numa::bindMode, nodes.data(), numa::maskNodes, 0U);
+  }
+
+  if (result != 0) {
+    const int error = errno;
+    ::munmap(slab, slabSize);
+    throw std::system_error{error, std::generic_category(), "Failed to apply the NUMA policy to a Chunk slab"};
+  }
+
+  return slab;
+#else
+  return ::operator new(slabSize, std::align_val_t{slabSize});
+#endif
+}
+
+inline void ChunkSlab::deallocateSlab(void *slab) noexcept {
+#ifdef __linux__
+  ::munmap(slab, slabSize);
+#else
+  ::operator delete(slab, slabSize, std::align_val_t{slabSize});
+#endif
+}
+
+inline void *ChunkSlab::allocate() {
+  std::lock_guard lock{mutex};
+
+  if (freeBlocks) {
+    FreeBlock *block = freeBlocks;
+    freeBlocks = block->next;
+    ++blockCount;
+    return block;
+  }
+
+  if (unusedEnd - unusedBlock < static_cast<std::ptrdiff_t>(blockSize)) {
+    slabs.reserve(slabs.size() + 1);
+
+    void *slab = allocateSlab();
+    slabs.push_back(slab);
+
+    // the remainder of the previous slab, too small for a block, is left unused
+    unusedBlock = static_cast<std::byte *>(slab);
+    unusedEnd = unusedBlock + slabSize;
+  }
+
+  void *block = unusedBlock;
+  unusedBlock += blockSize;
+  ++blockCount;
+  return block;
+}
+
+inline void ChunkSlab::deallocate(void *block) noexcept {
+  std::lock_guard lock{mutex};
+
+  freeBlocks = ::new(block) FreeBlock{freeBlocks};
+  --blockCount;
+}
+
+inline size_t ChunkSlab::getBlockSize() const {
+  return blockSize;
+}
+
+inline size_t ChunkSlab::getBlockAlignment() const {
+  return blockAlignment;
+}
+
+inline chunked_list_utility::NumaPolicy ChunkSlab::getNumaPolicy() const {
+  return numaPolicy;
+}
+
+inline size_t ChunkSlab::getSlabCount() const {
+  std::lock_guard lock{mutex};
+  return slabs.size();
+}
+
+inline size_t ChunkSlab::getBlockCount() const {
+  std::lock_guard lock{mutex};
+  return blockCount;
+}
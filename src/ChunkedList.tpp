@@ -1,169 +1,1489 @@
 #pragma once
 
+#include <fstream>
 #include <iostream>
 
 #include "ChunkedList.hpp"
 #include "internal/ChunkedListMacros.hpp"
 #include "internal/ChunkedListUtility.hpp"
 
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::reallocate(const size_t capacity, const size_t offset) {
+  std::shared_ptr<Chunk *[]> entries = std::make_shared<Chunk *[]>(capacity);
+  std::copy(chunks.get() + frontOffset, chunks.get() + backOffset, entries.get() + offset);
+
+  // the old buffer is freed here unless a Snapshot still reads it
+  chunks = std::move(entries);
+  backOffset = offset + backOffset - frontOffset;
+  frontOffset = offset;
+  entryCapacity = capacity;
+  sharedBegin = sharedEnd = 0;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::unshare(const size_t first, const size_t last) {
+  if (first < sharedEnd && sharedBegin < last)
+    reallocate(entryCapacity, frontOffset);
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::fillFromIndex(const size_t count) {
+  if (count > entryCapacity || (sharedBegin < sharedEnd && sharedBegin < count)) {
+    // the entries are rewritten from scratch, so none of the old ones are copied
+    const size_t capacity = std::max(count, entryCapacity);
+    chunks = std::make_shared<Chunk *[]>(capacity);
+    entryCapacity = capacity;
+    sharedBegin = sharedEnd = 0;
+  }
+
+  frontOffset = 0;
+  backOffset = count;
+
+  size_t node = chunkIndex.first();
+
+  for (size_t entry = 0; entry < count; ++entry, node = chunkIndex.next(node))
+    chunks[entry] = chunkIndex.chunk(node);
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::ChunkDirectory::ChunkDirectory(ChunkDirectory &&other) noexcept
+  : chunks{std::move(other.chunks)},
+    frontOffset{std::exchange(other.frontOffset, 0)},
+    backOffset{std::exchange(other.backOffset, 0)},
+    entryCapacity{std::exchange(other.entryCapacity, 0)},
+    sharedBegin{std::exchange(other.sharedBegin, 0)},
+    sharedEnd{std::exchange(other.sharedEnd, 0)},
+    chunkIndex{std::exchange(other.chunkIndex, {})},
+    dense{std::exchange(other.dense, true)} {
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::ChunkDirectory &ChunkedList<T, ChunkSize>::ChunkDirectory::operator=(
+  ChunkDirectory &&other) noexcept {
+  std::swap(chunks, other.chunks);
+  std::swap(frontOffset, other.frontOffset);
+  std::swap(backOffset, other.backOffset);
+  std::swap(entryCapacity, other.entryCapacity);
+  std::swap(sharedBegin, other.sharedBegin);
+  std::swap(sharedEnd, other.sharedEnd);
+  std::swap(chunkIndex, other.chunkIndex);
+  std::swap(dense, other.dense);
+  return *this;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::makeSparse() {
+  if (!dense)
+    return;
+
+  const size_t first = chunkIndex.build(chunks.get() + frontOffset, backOffset - frontOffset);
+
+  for (size_t entry = frontOffset; entry < backOffset; ++entry)
+    chunks[entry]->position = first + entry - frontOffset;
+
+  dense = false;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::makeDense() {
+  if (dense)
+    return;
+
+  // only filling the entries can throw, which leaves the directory sparse
+  fillFromIndex(chunkIndex.size());
+
+  for (size_t entry = 0; entry < backOffset; ++entry)
+    chunks[entry]->position = entry;
+
+  chunkIndex.clear();
+  dense = true;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::recount() {
+  if (!dense)
+    chunkIndex.recount();
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::insertAfter(Chunk *chunk, Chunk *newChunk) {
+  const bool back = !newChunk->nextChunk;
+
+  if (dense && back && chunk->nextIndex == ChunkSize) {
+    push_back(newChunk);
+    return;
+  }
+
+  makeSparse();
+  newChunk->position = chunkIndex.insertAfter(chunk->position, newChunk, back ? 0 : newChunk->nextIndex);
+
+  if (back)
+    chunkIndex.setSlots(chunk->position, chunk->nextIndex);
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::erase(const Chunk *chunk) {
+  if (dense) {
+    if (!chunk->nextChunk) {
+      pop_back();
+      return;
+    }
+
+    if (!chunk->prevChunk) {
+      pop_front();
+      return;
+    }
+
+    makeSparse();
+  }
+
+  chunkIndex.erase(chunk->position);
+
+  if (!chunk->nextChunk)
+    chunkIndex.setSlots(chunkIndex.last(), 0);
+
+  // a single Chunk is dense again, which needs no allocation unless its entry is still read by a Snapshot
+  if (chunkIndex.size() == 1 && sharedBegin == sharedEnd)
+    makeDense();
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::update(const Chunk *chunk) {
+  if (!chunk->nextChunk)
+    return;
+
+  if (!dense)
+    chunkIndex.setSlots(chunk->position, chunk->nextIndex);
+  else if (chunk->nextIndex != ChunkSize)
+    makeSparse();
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Chunk *&ChunkedList<T, ChunkSize>::ChunkDirectory::entry(const Chunk *chunk) {
+  if (!dense)
+    return chunkIndex.chunk(chunk->position);
+
+  return (*this)[chunk->position - front()->position];
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Chunk *ChunkedList<T, ChunkSize>::ChunkDirectory::entry(const Chunk *chunk) const {
+  return dense ? chunks[frontOffset + chunk->position - front()->position] : chunkIndex.chunk(chunk->position);
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkDirectory::indexOf(const Chunk *chunk) const {
+  return dense ? chunk->position - front()->position : chunkIndex.rank(chunk->position);
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkDirectory::slotsBefore(const Chunk *chunk) const {
+  return dense ? (chunk->position - front()->position) * ChunkSize : chunkIndex.slotsBefore(chunk->position);
+}
+
+template<typename T, size_t ChunkSize>
+std::pair<typename ChunkedList<T, ChunkSize>::Chunk *, size_t> ChunkedList<T, ChunkSize>::ChunkDirectory::locate(
+  const size_t slot) const {
+  if (dense)
+    return {chunks[frontOffset + slot / ChunkSize], slot % ChunkSize};
+
+  // the back Chunk has no slots in the ChunkIndex, so any slot past the other Chunks is in the back Chunk
+  if (const size_t slots = chunkIndex.slots(); slot >= slots)
+    return {back(), slot - slots};
+
+  const auto [node, chunkSlot] = chunkIndex.locate(slot);
+  return {chunkIndex.chunk(node), chunkSlot};
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Chunk *&ChunkedList<T, ChunkSize>::ChunkDirectory::operator[](const size_t index) {
+  unshare(frontOffset + index, frontOffset + index + 1);
+  return chunks[frontOffset + index];
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Chunk *ChunkedList<T, ChunkSize>::ChunkDirectory::operator[](
+  const size_t index) const {
+  return dense ? chunks[frontOffset + index] : chunkIndex.chunk(chunkIndex.at(index));
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkDirectory::size() const {
+  return dense ? backOffset - frontOffset : chunkIndex.size();
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkDirectory::allocatedBytes() const {
+  return entryCapacity * sizeof(Chunk *) + chunkIndex.allocatedBytes();
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Chunk *ChunkedList<T, ChunkSize>::ChunkDirectory::front() const {
+  return dense ? chunks[frontOffset] : chunkIndex.chunk(chunkIndex.first());
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Chunk *ChunkedList<T, ChunkSize>::ChunkDirectory::back() const {
+  return dense ? chunks[backOffset - 1] : chunkIndex.chunk(chunkIndex.last());
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::push_back(Chunk *chunk) {
+  if (!dense) {
+    // the old back Chunk only gets its slots once the new node is in, so that a throw leaves the ChunkIndex as it was
+    const size_t last = chunkIndex.last();
+    chunk->position = chunkIndex.insertAfter(last, chunk, 0);
+    chunkIndex.setSlots(last, chunkIndex.chunk(last)->nextIndex);
+    return;
+  }
+
+  if (backOffset == entryCapacity)
+    reallocate(std::max<size_t>(2 * entryCapacity, 1), frontOffset);
+  else
+    unshare(backOffset, backOffset + 1);
+
+  chunk->position = backOffset == frontOffset ? 0 : chunks[backOffset - 1]->position + 1;
+  chunks[backOffset++] = chunk;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::pop_back() {
+  if (dense) {
+    --backOffset;
+    return;
+  }
+
+  chunkIndex.erase(chunkIndex.last());
+  chunkIndex.setSlots(chunkIndex.last(), 0);
+
+  if (chunkIndex.size() == 1 && sharedBegin == sharedEnd)
+    makeDense();
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::push_front(Chunk *chunk) {
+  if (!dense) {
+    chunk->position = chunkIndex.insertAfter(ChunkIndex::none, chunk, chunk->nextIndex);
+    return;
+  }
+
+  if (frontOffset == 0) {
+    // reserving as many entries as are in use means the entries are only shifted again after doubling
+    const size_t reserved = std::max<size_t>(size(), 1);
+    reallocate(entryCapacity + reserved, reserved);
+  } else {
+    unshare(frontOffset - 1, frontOffset);
+  }
+
+  chunk->position = chunks[frontOffset]->position - 1;
+  chunks[--frontOffset] = chunk;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::pop_front() {
+  if (!dense) {
+    chunkIndex.erase(chunkIndex.first());
+
+    if (chunkIndex.size() == 1 && sharedBegin == sharedEnd)
+      makeDense();
+
+    return;
+  }
+
+  if (++frontOffset <= 2 * size())
+    return;
+
+  if (sharedBegin < sharedEnd) {
+    reallocate(entryCapacity, 0);
+    return;
+  }
+
+  std::copy(chunks.get() + frontOffset, chunks.get() + backOffset, chunks.get());
+  backOffset -= frontOffset;
+  frontOffset = 0;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::resize(const size_t size) {
+  const size_t newBackOffset = frontOffset + size;
+
+  if (newBackOffset > backOffset) {
+    reserve(size);
+    unshare(backOffset, newBackOffset);
+    std::fill(chunks.get() + backOffset, chunks.get() + newBackOffset, nullptr);
+  }
+
+  backOffset = newBackOffset;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::reserve(const size_t capacity) {
+  if (!dense)
+    chunkIndex.reserve(capacity);
+
+  if (frontOffset + capacity > entryCapacity)
+    reallocate(frontOffset + capacity, frontOffset);
+}
+
+template<typename T, size_t ChunkSize>
+std::pair<std::shared_ptr<typename ChunkedList<T, ChunkSize>::Chunk *[]>, typename ChunkedList<T, ChunkSize>::Chunk *
+  const *> ChunkedList<T, ChunkSize>::ChunkDirectory::share(const size_t count) {
+  if (count == 0)
+    return {};
+
+  if (!dense)
+    fillFromIndex(count);
+
+  sharedBegin = sharedBegin < sharedEnd ? std::min(sharedBegin, frontOffset) : frontOffset;
+  sharedEnd = std::max(sharedEnd, frontOffset + count);
+  return {chunks, chunks.get() + frontOffset};
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkDirectory::releaseShared() {
+  sharedBegin = sharedEnd = 0;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ensureChunk() {
+  if (backChunk)
+    return;
+
+  Chunk *chunk = acquireChunk();
+
+  try {
+    chunkDirectory.push_back(chunk);
+  } catch (...) {
+    releaseChunk(chunk);
+    throw;
+  }
+
+  frontChunk = backChunk = chunk;
+  chunkCount = 1;
+}
+
 template<typename T, size_t ChunkSize>
 void ChunkedList<T, ChunkSize>::pushChunk(Chunk *chunk) {
-  back->nextChunk = chunk;
-  chunk->prevChunk = back;
-  back = chunk;
+  backChunk->nextChunk = chunk;
+  chunk->prevChunk = backChunk;
+  backChunk = chunk;
+
+  chunkDirectory.push_back(chunk);
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::pushFrontChunk(Chunk *chunk) {
+  frontChunk->prevChunk = chunk;
+  chunk->nextChunk = frontChunk;
+  frontChunk = chunk;
+
+  chunkDirectory.push_front(chunk);
+}
+
+template<typename T, size_t ChunkSize>
+template<typename... Args>
+typename ChunkedList<T, ChunkSize>::Chunk *ChunkedList<T, ChunkSize>::allocateChunk(Args &&... args) {
+  Chunk *chunk;
+
+  if (!chunkSlab) {
+    chunk = new Chunk{std::forward<Args>(args)...};
+  } else {
+    void *block = chunkSlab->allocate(*chunkSlab->slab);
+
+    try {
+      chunk = ::new(block) Chunk{std::forward<Args>(args)...};
+      COUNTER_ADD(chunkAllocations, 1)
+    } catch (...) {
+      chunkSlab->deallocate(*chunkSlab->slab, block);
+      throw;
+    }
+  }
+
+  chunk->epoch = snapshotEpoch;
+  return chunk;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::deallocateChunk(Chunk *chunk) {
+  deallocateChunk(chunk, chunkSlab);
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::deallocateChunk(Chunk *chunk, const SlabAttachment *slab) {
+  if (!slab) {
+    delete chunk;
+    return;
+  }
+
+  chunk->~Chunk();
+  slab->deallocate(*slab->slab, chunk);
+  COUNTER_ADD(chunkDeallocations, 1)
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::SlabAttachment *ChunkedList<T, ChunkSize>::retainSlab(
+  SlabAttachment *attachment) noexcept {
+  if (attachment)
+    attachment->references.fetch_add(1, std::memory_order_relaxed);
+
+  return attachment;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::releaseSlab(SlabAttachment *attachment) noexcept {
+  if (attachment && attachment->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    delete attachment;
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Chunk *ChunkedList<T, ChunkSize>::acquireChunk() {
+  if (!spareChunks)
+    return allocateChunk();
+
+  Chunk *chunk = spareChunks;
+  spareChunks = chunk->nextChunk;
+  --spareChunkCount;
+
+  chunk->nextChunk = nullptr;
+  chunk->epoch = snapshotEpoch;
+  return chunk;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::releaseChunk(Chunk *chunk) {
+  if (sharingChunks && retireShared(chunk))
+    return;
+
+  const size_t retained = retentionPolicy == KeepSpareChunks ? spareChunkCount : chunkCount + spareChunkCount;
+
+  if (retained >= retentionLimit) {
+    deallocateChunk(chunk);
+    return;
+  }
+
+  chunk->clear();
+  chunk->prevChunk = nullptr;
+  chunk->nextChunk = spareChunks;
+  spareChunks = chunk;
+  ++spareChunkCount;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::linkChunk(Chunk *chunk, Chunk *newChunk) {
+  newChunk->prevChunk = chunk;
+  newChunk->nextChunk = chunk->nextChunk;
+
+  if (chunk->nextChunk)
+    chunk->nextChunk->prevChunk = newChunk;
+  else
+    backChunk = newChunk;
+
+  chunk->nextChunk = newChunk;
+  ++chunkCount;
+
+  chunkDirectory.insertAfter(chunk, newChunk);
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::unlinkChunk(Chunk *chunk) {
+  chunkDirectory.erase(chunk);
+
+  if (chunk->prevChunk)
+    chunk->prevChunk->nextChunk = chunk->nextChunk;
+  else
+    frontChunk = chunk->nextChunk;
+
+  if (chunk->nextChunk)
+    chunk->nextChunk->prevChunk = chunk->prevChunk;
+  else
+    backChunk = chunk->prevChunk;
+
+  --chunkCount;
+  releaseChunk(chunk);
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::releaseConsumedFront() {
+  if (!frontChunk->empty() || frontChunk == backChunk)
+    return;
+
+  // the next Chunk keeps its position, so the directory only drops its first entry
+  frontChunk->nextChunk->prevChunk = nullptr;
+  Chunk *consumed = frontChunk;
+  frontChunk = frontChunk->nextChunk;
+  --chunkCount;
+
+  chunkDirectory.pop_front();
+  releaseChunk(consumed);
+}
+
+template<typename T, size_t ChunkSize>
+std::pair<typename ChunkedList<T, ChunkSize>::Chunk *, size_t> ChunkedList<T, ChunkSize>::mergeChunk(Chunk *chunk) {
+  if (chunk->size() * 2 >= ChunkSize)
+    return {chunk, 0};
+
+  if (Chunk *prev = chunk->prevChunk; prev && prev->nextIndex + chunk->size() <= ChunkSize) {
+    prev = writableChunk(prev);
+    const size_t index = prev->nextIndex;
+    chunk->moveElementsTo(*prev, chunk->startIndex);
+    unlinkChunk(chunk);
+    chunkDirectory.update(prev);
+    return {prev, index};
+  }
+
+  if (Chunk *next = chunk->nextChunk; next && chunk->nextIndex + next->size() <= ChunkSize) {
+    // the elements are moved out of the next Chunk, which leaves a shared one to be copied first
+    next = writableChunk(next);
+    next->moveElementsTo(*chunk, next->startIndex);
+    unlinkChunk(next);
+    chunkDirectory.update(chunk);
+  }
+
+  return {chunk, 0};
+}
+
+template<typename T, size_t ChunkSize>
+inline void ChunkedList<T, ChunkSize>::prefetchAhead(const Chunk *chunk, const ChunkDirectory *directory) {
+  using policy = chunked_list_utility::prefetch_policy<T>;
+
+  if constexpr (policy::distance != 0 && policy::lines != 0) {
+    if (!chunk)
+      return;
+
+    const Chunk *ahead = chunk->nextChunk;
+
+    if (directory && directory->dense) {
+      const size_t index = chunk->position - directory->front()->position + policy::distance;
+      ahead = index < directory->size() ? (*directory)[index] : nullptr;
+    }
+
+    if (ahead)
+      chunked_list_utility::prefetch(ahead, policy::lines);
+  }
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::ChunkedList() {
+  frontChunk = backChunk = new Chunk{};
+  chunkDirectory.push_back(frontChunk);
+}
+
+template<typename T, size_t ChunkSize>
+template<std::same_as<ChunkSlab> Slab>
+typename ChunkedList<T, ChunkSize>::SlabAttachment *ChunkedList<T, ChunkSize>::attachSlab(
+  std::shared_ptr<Slab> slab) {
+  if (!slab)
+    return nullptr;
+
+  if (slab->getBlockSize() < sizeof(Chunk) || slab->getBlockAlignment() < alignof(Chunk))
+    throw std::invalid_argument{"The blocks of the ChunkSlab are too small or not aligned enough for a Chunk"};
+
+  return new SlabAttachment{
+    std::move(slab),
+    [](Slab &chunkSlab) { return chunkSlab.allocate(); },
+    [](Slab &chunkSlab, void *block) noexcept { chunkSlab.deallocate(block); }
+  };
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::ChunkedList(SlabAttachment *slab) : chunkSlab{slab} {
+  try {
+    frontChunk = backChunk = allocateChunk();
+    chunkDirectory.push_back(frontChunk);
+  } catch (...) {
+    if (frontChunk)
+      deallocateChunk(frontChunk);
+
+    releaseSlab(chunkSlab);
+    throw;
+  }
+}
+
+template<typename T, size_t ChunkSize>
+template<std::same_as<ChunkSlab> Slab>
+ChunkedList<T, ChunkSize>::ChunkedList(std::shared_ptr<Slab> slab) : ChunkedList(attachSlab(std::move(slab))) {
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::ChunkedList(std::initializer_list<T> initializerList) {
+  if (initializerList.size() == 0) {
+    frontChunk = backChunk = new Chunk{};
+    chunkDirectory.push_back(frontChunk);
+    return;
+  }
+
+  DEBUG_LOG("Initializer list size = " << initializerList.size())
+
+  DEBUG_EXECUTE({
+    int index = 0;
+    DEBUG_LOG(" (")
+
+    for (; index < initializerList.size() - 1; ++index) {
+    DEBUG_LOG(initializerList.begin()[index] << ", ")
+    }
+
+    DEBUG_LOG(initializerList.begin()[index] << ")")
+    DEBUG_LINE(true)
+    })
+
+  elementCount = initializerList.size();
+
+  if (ChunkSize >= initializerList.size()) {
+    frontChunk = backChunk = new Chunk{initializerList.begin(), initializerList.size()};
+    chunkDirectory.push_back(frontChunk);
+    return;
+  }
+
+  frontChunk = backChunk = new Chunk{initializerList.begin(), ChunkSize};
+
+  chunkCount = (initializerList.size() + ChunkSize - 1) / ChunkSize;
+
+  chunkDirectory.reserve(chunkCount);
+  chunkDirectory.push_back(frontChunk);
+
+  for (int offset = 1; offset < chunkCount - 1; ++offset) {
+    pushChunk(new Chunk{initializerList.begin() + (offset * ChunkSize), ChunkSize});
+  }
+
+  const int remainingItems = initializerList.size() % ChunkSize;
+  pushChunk(
+    new Chunk{
+      initializerList.begin() + (chunkCount - 1) * ChunkSize, remainingItems == 0 ? ChunkSize : remainingItems
+    });
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::ChunkedList(const ChunkedList &other) : ChunkedList(retainSlab(other.chunkSlab)) {
+  retentionPolicy = other.retentionPolicy;
+  retentionLimit = other.retentionLimit;
+
+  reserve(other.size());
+
+  for (const std::span<const T> elements: other.chunks()) {
+    if (!elements.empty())
+      appendCount(elements.begin(), elements.size());
+  }
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::ChunkedList(ChunkedList &&other) noexcept {
+  // the other ChunkedList is left without any Chunk rather than allocating one here, and gets its first Chunk once
+  // elements are added to it again
+  swap(other);
+  other.chunkCount = 0;
+  other.chunkSlab = retainSlab(chunkSlab);
+  other.retentionPolicy = retentionPolicy;
+  other.retentionLimit = retentionLimit;
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize> &ChunkedList<T, ChunkSize>::operator=(const ChunkedList &other) {
+  if (this != &other) {
+    ChunkedList copy{other};
+    swap(copy);
+  }
+
+  return *this;
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize> &ChunkedList<T, ChunkSize>::operator=(ChunkedList &&other) noexcept {
+  swap(other);
+  return *this;
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::~ChunkedList() {
+  shrinkToFit();
+
+  while (backChunk) {
+    Chunk *newBack = backChunk->prevChunk;
+
+    // Chunks still shared with a Snapshot are left for it to deallocate
+    if (!sharingChunks || !retireShared(backChunk))
+      deallocateChunk(backChunk);
+
+    backChunk = newBack;
+  }
+
+  releaseSlab(chunkSlab);
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::swap(ChunkedList &other) noexcept {
+  std::swap(chunkCount, other.chunkCount);
+  std::swap(elementCount, other.elementCount);
+  std::swap(frontChunk, other.frontChunk);
+  std::swap(backChunk, other.backChunk);
+  std::swap(chunkDirectory, other.chunkDirectory);
+  std::swap(spareChunks, other.spareChunks);
+  std::swap(spareChunkCount, other.spareChunkCount);
+  std::swap(retentionPolicy, other.retentionPolicy);
+  std::swap(retentionLimit, other.retentionLimit);
+  std::swap(chunkSlab, other.chunkSlab);
+  std::swap(snapshotStates, other.snapshotStates);
+  std::swap(sharingChunks, other.sharingChunks);
+  std::swap(snapshotEpoch, other.snapshotEpoch);
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::splice(ChunkedList &&other) {
+  if (this == &other || other.empty())
+    return;
+
+  if (slab() != other.slab()) {
+    // a Chunk has to be returned to whatever allocated it, so only the elements can move between allocators
+    appendCount(std::make_move_iterator(other.begin()), other.size());
+    other.truncate(0);
+    return;
+  }
+
+  if (empty()) {
+    std::swap(chunkCount, other.chunkCount);
+    std::swap(elementCount, other.elementCount);
+    std::swap(frontChunk, other.frontChunk);
+    std::swap(backChunk, other.backChunk);
+    std::swap(chunkDirectory, other.chunkDirectory);
+    std::swap(snapshotStates, other.snapshotStates);
+    std::swap(sharingChunks, other.sharingChunks);
+    std::swap(snapshotEpoch, other.snapshotEpoch);
+    return;
+  }
+
+  if (backChunk->empty())
+    removeBackChunk();
+
+  // the relinked Chunks are no longer read through the other ChunkedList's Snapshots, so they stop being shared
+  other.unshareChunks();
+
+  if (other.frontChunk->startIndex != 0) {
+    // only the front Chunk may start part way through its storage
+    other.frontChunk->compact();
+    other.chunkDirectory.update(other.frontChunk);
+  }
+
+  // a partially filled back Chunk is left in the middle, after which Chunks are found through the ChunkIndex
+  const bool staysDense = chunkDirectory.dense && other.chunkDirectory.dense && backChunk->nextIndex == ChunkSize;
+
+  // everything which may throw happens before relinking, so that neither ChunkedList is left sharing Chunks
+  ChunkDirectory otherDirectory{};
+  Chunk *otherChunk = other.acquireChunk();
+  size_t directoryIndex = chunkCount;
+
+  try {
+    otherDirectory.push_back(otherChunk);
+
+    if (staysDense) {
+      chunkDirectory.resize(chunkCount + other.chunkCount);
+    } else {
+      chunkDirectory.makeSparse();
+      chunkDirectory.reserve(chunkCount + other.chunkCount);
+    }
+  } catch (...) {
+    other.releaseChunk(otherChunk);
+    throw;
+  }
+
+  backChunk->nextChunk = other.frontChunk;
+  other.frontChunk->prevChunk = backChunk;
+
+  for (Chunk *chunk = other.frontChunk; chunk; chunk = chunk->nextChunk) {
+    chunk->epoch = snapshotEpoch;
+
+    if (staysDense) {
+      chunk->position = chunk->prevChunk->position + 1;
+      chunkDirectory[directoryIndex++] = chunk;
+    } else {
+      chunkDirectory.push_back(chunk);
+    }
+  }
+
+  backChunk = other.backChunk;
+  chunkCount += other.chunkCount;
+  elementCount += other.elementCount;
+
+  other.frontChunk = other.backChunk = otherChunk;
+  other.chunkCount = 1;
+  other.elementCount = 0;
+  other.chunkDirectory = std::move(otherDirectory);
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::append(ChunkedList &&other) {
+  splice(std::move(other));
+}
+
+template<typename T, size_t ChunkSize>
+T &ChunkedList<T, ChunkSize>::operator[](const size_t index) {
+  if (!sharingChunks)
+    return const_cast<T &>(std::as_const(*this)[index]);
+
+  const auto [chunk, slot] = locate(index);
+  return (*writableChunk(chunk))[slot];
+}
+
+template<typename T, size_t ChunkSize>
+const T &ChunkedList<T, ChunkSize>::operator[](const size_t index) const {
+  const auto [chunk, slot] = locate(index);
+  return (*chunk)[slot];
+}
+
+template<typename T, size_t ChunkSize>
+std::pair<typename ChunkedList<T, ChunkSize>::Chunk *, size_t> ChunkedList<T, ChunkSize>::locate(size_t index) const {
+  // elements are located by their slot, counting from the start of the front Chunk's storage
+  return chunkDirectory.locate(index + frontChunk->startIndex);
+}
+
+template<typename T, size_t ChunkSize>
+T &ChunkedList<T, ChunkSize>::front() {
+  if (sharingChunks)
+    writableChunk(frontChunk);
+
+  return const_cast<T &>(std::as_const(*this).front());
+}
+
+template<typename T, size_t ChunkSize>
+const T &ChunkedList<T, ChunkSize>::front() const {
+  return (*frontChunk)[frontChunk->startIndex];
+}
+
+template<typename T, size_t ChunkSize>
+T &ChunkedList<T, ChunkSize>::back() {
+  if (sharingChunks)
+    writableChunk(backChunk->empty() ? backChunk->prevChunk : backChunk);
+
+  return const_cast<T &>(std::as_const(*this).back());
+}
+
+template<typename T, size_t ChunkSize>
+const T &ChunkedList<T, ChunkSize>::back() const {
+  // the back Chunk is empty after popping its last element, leaving the last element in the Chunk before it
+  const Chunk *chunk = backChunk->empty() ? backChunk->prevChunk : backChunk;
+  return (*chunk)[chunk->nextIndex - 1];
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Iterator ChunkedList<T, ChunkSize>::begin() {
+  return Iterator{ChunkIterator{frontChunk, this}, frontChunk ? frontChunk->startIndex : 0};
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::ConstIterator ChunkedList<T, ChunkSize>::begin() const {
+  return ConstIterator{ConstChunkIterator{frontChunk, this}, frontChunk ? frontChunk->startIndex : 0};
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Iterator ChunkedList<T, ChunkSize>::end() {
+  return Iterator{ChunkIterator{backChunk, this}, backChunk ? backChunk->nextIndex : 0};
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::ConstIterator ChunkedList<T, ChunkSize>::end() const {
+  return ConstIterator{ConstChunkIterator{backChunk, this}, backChunk ? backChunk->nextIndex : 0};
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::ChunkIterator ChunkedList<T, ChunkSize>::beginChunk() {
+  return ChunkIterator{frontChunk, this};
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::ConstChunkIterator ChunkedList<T, ChunkSize>::beginChunk() const {
+  return ConstChunkIterator{frontChunk, this};
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::ChunkIterator ChunkedList<T, ChunkSize>::endChunk() {
+  return ChunkIterator{nullptr, this};
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::ConstChunkIterator ChunkedList<T, ChunkSize>::endChunk() const {
+  return ConstChunkIterator{nullptr, this};
+}
+
+template<typename T, size_t ChunkSize>
+template<typename ChunkT, typename ValueT>
+std::span<ValueT> ChunkedList<T, ChunkSize>::GenericChunkSpan<ChunkT, ValueT>::operator()(ChunkT &chunk) const {
+  return chunk.elements();
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::ChunkSpanRange ChunkedList<T, ChunkSize>::chunks() {
+  return ChunkSpanRange{std::ranges::subrange{beginChunk(), endChunk()}, GenericChunkSpan<Chunk, T>{}};
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::ConstChunkSpanRange ChunkedList<T, ChunkSize>::chunks() const {
+  return ConstChunkSpanRange{std::ranges::subrange{beginChunk(), endChunk()}, GenericChunkSpan<const Chunk, const T>{}};
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::push(T value) {
+  emplace(std::move(value));
+}
+
+template<typename T, size_t ChunkSize>
+template<typename... Args>
+T &ChunkedList<T, ChunkSize>::emplace(Args &&... args) {
+  ensureChunk();
+
+  if (backChunk->nextIndex == ChunkSize) {
+    pushChunk(acquireChunk());
+    ++chunkCount;
+  }
+
+  T &element = backChunk->emplace(std::forward<Args>(args)...);
+  ++elementCount;
+  COUNTER_ADD(pushes, 1)
+  return element;
 }
 
 template<typename T, size_t ChunkSize>
-ChunkedList<T, ChunkSize>::ChunkedList() {
-  front = back = new Chunk{};
+void ChunkedList<T, ChunkSize>::pushFront(T value) {
+  emplaceFront(std::move(value));
 }
 
 template<typename T, size_t ChunkSize>
-ChunkedList<T, ChunkSize>::ChunkedList(std::initializer_list<T> initializerList) {
-  if (initializerList.size() == 0) {
-    front = back = new Chunk{};
-    return;
+template<typename... Args>
+T &ChunkedList<T, ChunkSize>::emplaceFront(Args &&... args) {
+  if (elementCount == 0)
+    return emplace(std::forward<Args>(args)...);
+
+  if (frontChunk->startIndex == 0) {
+    Chunk *chunk = acquireChunk();
+    chunk->startIndex = chunk->nextIndex = ChunkSize;
+
+    // the element is constructed before the Chunk is linked, so that a throwing constructor leaves no empty Chunk at
+    // the front
+    try {
+      chunk->emplaceFront(std::forward<Args>(args)...);
+    } catch (...) {
+      releaseChunk(chunk);
+      throw;
+    }
+
+    pushFrontChunk(chunk);
+    ++chunkCount;
+    ++elementCount;
+    COUNTER_ADD(pushes, 1)
+    return (*chunk)[chunk->startIndex];
   }
 
-  DEBUG_LOG("Initializer list size = " << initializerList.size())
+  T &element = writableChunk(frontChunk)->emplaceFront(std::forward<Args>(args)...);
+  ++elementCount;
+  COUNTER_ADD(pushes, 1)
+  return element;
+}
 
-  DEBUG_EXECUTE({
-    int index = 0;
-    DEBUG_LOG(" (")
+template<typename T, size_t ChunkSize>
+template<typename InputIterator>
+void ChunkedList<T, ChunkSize>::appendCount(InputIterator first, size_t count) {
+  reserve(size() + count);
 
-    for (; index < initializerList.size() - 1; ++index) {
-    DEBUG_LOG(initializerList.begin()[index] << ", ")
+  while (count > 0) {
+    if (backChunk->nextIndex == ChunkSize) {
+      pushChunk(acquireChunk());
+      ++chunkCount;
     }
 
-    DEBUG_LOG(initializerList.begin()[index] << ")")
-    DEBUG_LINE(true)
-    })
+    const size_t chunkItems = std::min(count, ChunkSize - backChunk->nextIndex);
+    first = backChunk->append(std::move(first), chunkItems);
+    elementCount += chunkItems;
+    count -= chunkItems;
+  }
+}
 
-  if (ChunkSize >= initializerList.size()) {
-    front = back = new Chunk{initializerList.begin(), initializerList.size()};
-    return;
+template<typename T, size_t ChunkSize>
+template<std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+void ChunkedList<T, ChunkSize>::append(InputIterator first, Sentinel last) {
+  if constexpr (std::forward_iterator<InputIterator> || std::sized_sentinel_for<Sentinel, InputIterator>) {
+    const auto count = static_cast<size_t>(std::ranges::distance(first, last));
+    appendCount(std::move(first), count);
+  } else {
+    for (; first != last; ++first)
+      emplace(*first);
+  }
+}
+
+template<typename T, size_t ChunkSize>
+template<std::ranges::input_range Range>
+void ChunkedList<T, ChunkSize>::append(Range &&range) {
+  if constexpr (std::ranges::sized_range<Range>) {
+    appendCount(std::ranges::begin(range), static_cast<size_t>(std::ranges::size(range)));
+  } else {
+    append(std::ranges::begin(range), std::ranges::end(range));
   }
+}
 
-  front = back = new Chunk{initializerList.begin(), ChunkSize};
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::reserve(const size_t capacity) {
+  ensureChunk();
 
-  chunkCount = (initializerList.size() + ChunkSize - 1) / ChunkSize;
+  const size_t currentCapacity = size() + ChunkSize - backChunk->nextIndex;
 
-  for (int offset = 1; offset < chunkCount - 1; ++offset) {
-    pushChunk(new Chunk{initializerList.begin() + (offset * ChunkSize), ChunkSize});
+  if (capacity <= currentCapacity)
+    return;
+
+  const size_t requiredChunks = (capacity - currentCapacity + ChunkSize - 1) / ChunkSize;
+
+  while (spareChunkCount < requiredChunks) {
+    Chunk *chunk = allocateChunk();
+    chunk->nextChunk = spareChunks;
+    spareChunks = chunk;
+    ++spareChunkCount;
   }
 
-  const int remainingItems = initializerList.size() % ChunkSize;
-  pushChunk(
-    new Chunk{
-      initializerList.begin() + (chunkCount - 1) * ChunkSize, remainingItems == 0 ? ChunkSize : remainingItems
-    });
+  chunkDirectory.reserve(chunkCount + requiredChunks);
 }
 
 template<typename T, size_t ChunkSize>
-ChunkedList<T, ChunkSize>::~ChunkedList() {
-  do {
-    Chunk *newBack = back->prevChunk;
-    delete back;
-    back = newBack;
-  } while (back);
+void ChunkedList<T, ChunkSize>::truncate(const size_t size) {
+  while (chunkCount > 1 && elementCount - backChunk->size() >= size)
+    removeBackChunk();
+
+  if (elementCount > size)
+    writableChunk(backChunk);
+
+  for (; elementCount > size; --elementCount)
+    backChunk->pop();
 }
 
 template<typename T, size_t ChunkSize>
-T &ChunkedList<T, ChunkSize>::operator[](const size_t index) {
-  size_t chunkIndex = index / ChunkSize;
+void ChunkedList<T, ChunkSize>::resize(const size_t size) {
+  if (size <= this->size()) {
+    truncate(size);
+    return;
+  }
 
-  Chunk *chunk = front;
+  reserve(size);
 
-  while (chunkIndex-- > 0) {
-    chunk = chunk->nextChunk;
-  }
+  for (size_t currentSize = this->size(); currentSize < size; currentSize = this->size()) {
+    if (backChunk->nextIndex == ChunkSize) {
+      pushChunk(acquireChunk());
+      ++chunkCount;
+    }
 
-  return (*chunk)[index % ChunkSize];
+    const size_t chunkItems = std::min(size - currentSize, ChunkSize - backChunk->nextIndex);
+    backChunk->appendDefault(chunkItems);
+    elementCount += chunkItems;
+  }
 }
 
 template<typename T, size_t ChunkSize>
-const T &ChunkedList<T, ChunkSize>::operator[](const size_t index) const {
-  return const_cast<ChunkedList>(*this).operator[](index);
+void ChunkedList<T, ChunkSize>::resize(const size_t size, const T &value) {
+  if (size <= this->size()) {
+    truncate(size);
+    return;
+  }
+
+  reserve(size);
+
+  for (size_t currentSize = this->size(); currentSize < size; currentSize = this->size()) {
+    if (backChunk->nextIndex == ChunkSize) {
+      pushChunk(acquireChunk());
+      ++chunkCount;
+    }
+
+    const size_t chunkItems = std::min(size - currentSize, ChunkSize - backChunk->nextIndex);
+    backChunk->appendCopies(chunkItems, value);
+    elementCount += chunkItems;
+  }
 }
 
 template<typename T, size_t ChunkSize>
-typename ChunkedList<T, ChunkSize>::Iterator ChunkedList<T, ChunkSize>::begin() {
-  return Iterator{front, 0};
+size_t ChunkedList<T, ChunkSize>::capacity() const {
+  const size_t backCapacity = backChunk ? ChunkSize - backChunk->nextIndex : 0;
+  return size() + backCapacity + spareChunkCount * ChunkSize;
 }
 
 template<typename T, size_t ChunkSize>
-typename ChunkedList<T, ChunkSize>::ConstIterator ChunkedList<T, ChunkSize>::begin() const {
-  return ConstIterator{front, 0};
+typename ChunkedList<T, ChunkSize>::Stats ChunkedList<T, ChunkSize>::stats() const {
+  const size_t slots = chunkCount * ChunkSize;
+
+  return Stats{
+    .chunkCount = chunkCount,
+    .spareChunkCount = spareChunkCount,
+    .elementCount = elementCount,
+    .bytesAllocated = (chunkCount + spareChunkCount) * sizeof(Chunk) + chunkDirectory.allocatedBytes(),
+    .bytesWasted = (slots - elementCount) * sizeof(T),
+    .fillRatio = slots == 0 ? 0 : static_cast<double>(elementCount) / static_cast<double>(slots),
+  };
 }
 
+#ifdef CHUNKED_LIST_COUNTERS
 template<typename T, size_t ChunkSize>
-typename ChunkedList<T, ChunkSize>::Iterator ChunkedList<T, ChunkSize>::end() {
-  return Iterator{back, back->nextIndex};
+typename ChunkedList<T, ChunkSize>::Counters ChunkedList<T, ChunkSize>::counters() {
+  return Counters{
+    .chunkAllocations = counterStorage.chunkAllocations.load(std::memory_order_relaxed),
+    .chunkDeallocations = counterStorage.chunkDeallocations.load(std::memory_order_relaxed),
+    .pushes = counterStorage.pushes.load(std::memory_order_relaxed),
+    .pops = counterStorage.pops.load(std::memory_order_relaxed),
+    .chunkHops = counterStorage.chunkHops.load(std::memory_order_relaxed),
+  };
 }
 
 template<typename T, size_t ChunkSize>
-typename ChunkedList<T, ChunkSize>::ConstIterator ChunkedList<T, ChunkSize>::end() const {
-  return ConstIterator{back, back->nextIndex};
+void ChunkedList<T, ChunkSize>::resetCounters() {
+  counterStorage.chunkAllocations.store(0, std::memory_order_relaxed);
+  counterStorage.chunkDeallocations.store(0, std::memory_order_relaxed);
+  counterStorage.pushes.store(0, std::memory_order_relaxed);
+  counterStorage.pops.store(0, std::memory_order_relaxed);
+  counterStorage.chunkHops.store(0, std::memory_order_relaxed);
 }
+#endif
 
 template<typename T, size_t ChunkSize>
-typename ChunkedList<T, ChunkSize>::ChunkIterator ChunkedList<T, ChunkSize>::beginChunk() {
-  return ChunkIterator{front};
+typename ChunkedList<T, ChunkSize>::Iterator ChunkedList<T, ChunkSize>::makeIterator(Chunk *chunk, const size_t index) {
+  if (index == chunk->nextIndex && chunk->nextChunk)
+    return Iterator{ChunkIterator{chunk->nextChunk, this}, 0};
+
+  return Iterator{ChunkIterator{chunk, this}, index};
 }
 
 template<typename T, size_t ChunkSize>
-typename ChunkedList<T, ChunkSize>::ConstChunkIterator ChunkedList<T, ChunkSize>::beginChunk() const {
-  return ConstChunkIterator{front};
+typename ChunkedList<T, ChunkSize>::Iterator ChunkedList<T, ChunkSize>::insert(Iterator position, T value) {
+  if (!backChunk) {
+    emplace(std::move(value));
+    return begin();
+  }
+
+  // the position's Chunk may have been replaced with its copy through another Iterator
+  position = makeIterator(std::as_const(chunkDirectory).entry(position.getChunkIterator().getChunk()),
+                          position.getIndex());
+
+  Chunk *chunk = position.getChunkIterator().getChunk();
+  size_t index = position.getIndex();
+
+  if (chunk == backChunk && index == backChunk->nextIndex) {
+    emplace(std::move(value));
+    return Iterator{ChunkIterator{backChunk, this}, backChunk->nextIndex - 1};
+  }
+
+  chunk = writableChunk(chunk);
+
+  if (chunk->nextIndex == ChunkSize && chunk->startIndex != 0) {
+    // the front Chunk has free space before its elements, which is moved to the end instead of splitting the Chunk
+    index -= chunk->startIndex;
+    chunk->compact();
+  }
+
+  if (chunk->nextIndex == ChunkSize) {
+    // split the full Chunk in two, so that only half of its elements have to be shifted
+    constexpr size_t splitIndex = ChunkSize / 2;
+
+    Chunk *newChunk = acquireChunk();
+    chunk->moveElementsTo(*newChunk, splitIndex);
+    linkChunk(chunk, newChunk);
+    chunkDirectory.update(chunk);
+
+    if (index > splitIndex) {
+      chunk = newChunk;
+      index -= splitIndex;
+    }
+  }
+
+  chunk->insert(index, std::move(value));
+  ++elementCount;
+  chunkDirectory.update(chunk);
+
+  return Iterator{ChunkIterator{chunk, this}, index};
 }
 
 template<typename T, size_t ChunkSize>
-typename ChunkedList<T, ChunkSize>::ChunkIterator ChunkedList<T, ChunkSize>::endChunk() {
-  return ChunkIterator{nullptr};
+template<std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+typename ChunkedList<T, ChunkSize>::Iterator ChunkedList<T, ChunkSize>::insert(Iterator position, InputIterator first,
+                                                                              Sentinel last) {
+  if (!backChunk) {
+    append(std::move(first), std::move(last));
+    return begin();
+  }
+
+  // the position's Chunk may have been replaced with its copy through another Iterator
+  position = makeIterator(std::as_const(chunkDirectory).entry(position.getChunkIterator().getChunk()),
+                          position.getIndex());
+
+  Chunk *chunk = position.getChunkIterator().getChunk();
+  const size_t index = position.getIndex();
+
+  if (first == last)
+    return position;
+
+  if (chunk == backChunk && index == backChunk->nextIndex) {
+    append(std::move(first), std::move(last));
+    return makeIterator(chunk, index);
+  }
+
+  chunk = writableChunk(chunk);
+
+  // move the elements after the position into their own Chunk, then fill new Chunks linked in between
+  Chunk *tail = acquireChunk();
+  chunk->moveElementsTo(*tail, index);
+  linkChunk(chunk, tail);
+
+  Chunk *current = chunk;
+
+  for (; first != last; ++first) {
+    if (current->nextIndex == ChunkSize) {
+      Chunk *newChunk = acquireChunk();
+      linkChunk(current, newChunk);
+      current = newChunk;
+    }
+
+    current->emplace(*first);
+    ++elementCount;
+  }
+
+  if (current->nextIndex + tail->nextIndex <= ChunkSize) {
+    tail->moveElementsTo(*current, 0);
+    unlinkChunk(tail);
+  }
+
+  // the filled Chunks are only updated once they are final, rather than after every element
+  for (Chunk *filled = chunk; filled != current->nextChunk; filled = filled->nextChunk)
+    chunkDirectory.update(filled);
+
+  return Iterator{ChunkIterator{chunk, this}, index};
 }
 
 template<typename T, size_t ChunkSize>
-typename ChunkedList<T, ChunkSize>::ConstChunkIterator ChunkedList<T, ChunkSize>::endChunk() const {
-  return ConstChunkIterator{nullptr};
+typename ChunkedList<T, ChunkSize>::Iterator ChunkedList<T, ChunkSize>::erase(Iterator position) {
+  return erase(position, std::next(position));
 }
 
 template<typename T, size_t ChunkSize>
-void ChunkedList<T, ChunkSize>::push(T value) {
-  if (back->nextIndex == ChunkSize) {
-    pushChunk(new Chunk{std::forward<T>(value)});
-    ++chunkCount;
+typename ChunkedList<T, ChunkSize>::Iterator ChunkedList<T, ChunkSize>::erase(Iterator first, Iterator last) {
+  if (!backChunk)
+    return end();
+
+  // either Chunk may have been replaced with its copy through another Iterator
+  Chunk *chunk = std::as_const(chunkDirectory).entry(first.getChunkIterator().getChunk());
+  const size_t index = first.getIndex();
+
+  if (first == last)
+    return makeIterator(chunk, index);
+
+  Chunk *lastChunk = std::as_const(chunkDirectory).entry(last.getChunkIterator().getChunk());
+  const size_t lastIndex = last.getIndex();
+
+  // the Chunks erased entirely are only unlinked, so only the first and last ones are copied if they are shared
+  chunk = writableChunk(chunk);
+
+  if (lastChunk != chunk)
+    lastChunk = writableChunk(lastChunk);
+
+  if (chunk == lastChunk) {
+    chunk->erase(index, lastIndex - index);
+    elementCount -= lastIndex - index;
+  } else {
+    elementCount -= chunk->nextIndex - index;
+    chunk->erase(index, chunk->nextIndex - index);
+
+    // Chunks which are erased entirely are unlinked rather than having their elements shifted
+    for (Chunk *current = chunk->nextChunk; current != lastChunk;) {
+      Chunk *next = current->nextChunk;
+      elementCount -= current->size();
+      unlinkChunk(current);
+      current = next;
+    }
+
+    lastChunk->erase(0, lastIndex);
+    elementCount -= lastIndex;
+
+    if (lastChunk->empty() && lastChunk != backChunk)
+      unlinkChunk(lastChunk);
+    else
+      chunkDirectory.update(lastChunk);
+  }
+
+  Chunk *resultChunk;
+  size_t resultIndex;
+
+  if (chunk->empty() && chunk->nextChunk) {
+    resultChunk = chunk->nextChunk;
+    resultIndex = 0;
+    unlinkChunk(chunk);
   } else {
-    (*back)[back->nextIndex] = std::forward<T>(value);
-    ++back->nextIndex;
+    chunkDirectory.update(chunk);
+
+    const auto [mergedChunk, offset] = mergeChunk(chunk);
+    resultChunk = mergedChunk;
+    // an emptied Chunk is reset to the start of its storage
+    resultIndex = resultChunk->empty() ? 0 : offset + index;
   }
+
+  return makeIterator(resultChunk, resultIndex);
 }
 
 template<typename T, size_t ChunkSize>
-template<typename... Args>
-void ChunkedList<T, ChunkSize>::emplace(Args &&... args) {
-  if (back->nextIndex == ChunkSize) {
-    pushChunk(new Chunk{T(std::forward<Args>(args)...)});
-  } else {
-    (*back)[back->nextIndex] = std::move(T(std::forward<Args>(args)...));
-    ++back->nextIndex;
+template<std::predicate<const T &> Predicate>
+size_t ChunkedList<T, ChunkSize>::eraseIf(Predicate predicate) {
+  if (elementCount == 0)
+    return 0;
+
+  // kept elements are moved across every Chunk, so shared ones are copied up front
+  unshareChunks();
+
+  const size_t initialCount = elementCount;
+  size_t keptCount = 0;
+
+  // every kept element is moved to the next write slot, which is never ahead of the element being read, so the kept
+  // elements end up in order at the front and the moved-from ones after them. Write slots fill each Chunk to the end
+  // of its storage, constructing into the slots past its next index which a partially filled Chunk leaves unused
+  Chunk *writeChunk = frontChunk;
+  size_t writeIndex = frontChunk->startIndex;
+
+  try {
+    for (Chunk *readChunk = frontChunk; readChunk; readChunk = readChunk->nextChunk) {
+      prefetchAhead(readChunk, &chunkDirectory);
+
+      for (size_t readIndex = readChunk->startIndex; readIndex < readChunk->nextIndex; ++readIndex) {
+        T &element = (*readChunk)[readIndex];
+
+        if (predicate(std::as_const(element)))
+          continue;
+
+        if (writeIndex == ChunkSize) {
+          writeChunk = writeChunk->nextChunk;
+          writeIndex = 0;
+        }
+
+        if (writeChunk != readChunk || writeIndex != readIndex) {
+          if (writeIndex < writeChunk->nextIndex) {
+            (*writeChunk)[writeIndex] = std::move(element);
+          } else {
+            writeChunk->emplace(std::move(element));
+            // the constructed element is counted, so that the count stays accurate if a later move throws
+            ++elementCount;
+          }
+        }
+
+        ++writeIndex;
+        ++keptCount;
+      }
+    }
+  } catch (...) {
+    // kept elements may have been constructed past the next index of partially filled Chunks in the middle
+    chunkDirectory.recount();
+    throw;
   }
+
+  truncate(keptCount);
+
+  // every Chunk before the back one has been filled to the end of its storage
+  chunkDirectory.recount();
+  chunkDirectory.makeDense();
+
+  return initialCount - keptCount;
+}
+
+template<typename T, size_t ChunkSize>
+template<std::predicate<const T &> Predicate>
+size_t ChunkedList<T, ChunkSize>::retain(Predicate predicate) {
+  return eraseIf([&predicate](const T &element) { return !predicate(element); });
 }
 
 template<typename T, size_t ChunkSize>
 void ChunkedList<T, ChunkSize>::pop() {
-  if (back->nextIndex == 0)
+  if (elementCount == 0)
+    return;
+
+  // an empty back Chunk is left after a full one, which holds the last element
+  if (backChunk->empty())
     popChunk();
-  else
-    --back->nextIndex;
+
+  writableChunk(backChunk)->pop();
+  --elementCount;
+  COUNTER_ADD(pops, 1)
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::popFront() {
+  if (elementCount == 0)
+    return;
+
+  writableChunk(frontChunk)->popFront(1);
+  --elementCount;
+  COUNTER_ADD(pops, 1)
+
+  if (frontChunk->empty())
+    releaseConsumedFront();
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::popFront(size_t count) {
+  count = std::min(count, elementCount);
+  elementCount -= count;
+  COUNTER_ADD(pops, count)
+
+  while (count > 0) {
+    const size_t chunkElements = std::min(count, frontChunk->size());
+    writableChunk(frontChunk)->popFront(chunkElements);
+    count -= chunkElements;
+    releaseConsumedFront();
+  }
 }
 
 template<typename T, size_t ChunkSize>
 void ChunkedList<T, ChunkSize>::popChunk() {
-  if (Chunk *newBack = back->prevChunk; newBack) {
-    delete back;
-    back = newBack;
+  if (!backChunk)
+    return;
+
+  COUNTER_ADD(pops, backChunk->size())
+  removeBackChunk();
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::removeBackChunk() {
+  const size_t removedCount = backChunk->size();
+
+  if (Chunk *newBack = backChunk->prevChunk; newBack) {
+    // a partially filled back Chunk is never shared, as it is appended to in place
+    if (newBack->nextIndex != ChunkSize)
+      newBack = writableChunk(newBack);
+
+    newBack->nextChunk = nullptr;
     --chunkCount;
-    --back->nextIndex;
+    chunkDirectory.pop_back();
+    releaseChunk(backChunk);
+    backChunk = newBack;
+  } else {
+    writableChunk(backChunk)->clear();
+  }
+
+  elementCount -= removedCount;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::setRetentionPolicy(const RetentionPolicy policy, const size_t limit) {
+  retentionPolicy = policy;
+  retentionLimit = limit;
+
+  const size_t spareLimit = policy == KeepSpareChunks ? limit : (limit > chunkCount ? limit - chunkCount : 0);
+
+  while (spareChunkCount > spareLimit) {
+    Chunk *chunk = spareChunks;
+    spareChunks = chunk->nextChunk;
+    --spareChunkCount;
+    deallocateChunk(chunk);
+  }
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::shrinkToFit() {
+  while (spareChunks) {
+    Chunk *chunk = spareChunks;
+    spareChunks = chunk->nextChunk;
+    deallocateChunk(chunk);
   }
+
+  spareChunkCount = 0;
+}
+
+template<typename T, size_t ChunkSize>
+const std::shared_ptr<ChunkSlab> &ChunkedList<T, ChunkSize>::slab() const {
+  static const std::shared_ptr<ChunkSlab> noSlab{};
+  return chunkSlab ? chunkSlab->slab : noSlab;
 }
 
 template<typename T, size_t ChunkSize>
@@ -175,12 +1495,12 @@ void ChunkedList<T, ChunkSize>::sort() {
 
 template<typename T, size_t ChunkSize>
 size_t ChunkedList<T, ChunkSize>::size() const {
-  return (chunkCount - 1) * ChunkSize + back->nextIndex;
+  return elementCount;
 }
 
 template<typename T, size_t ChunkSize>
 bool ChunkedList<T, ChunkSize>::empty() const {
-  return back->nextIndex == 0;
+  return size() == 0;
 }
 
 template<typename T, size_t ChunkSize>
@@ -210,48 +1530,202 @@ bool ChunkedList<T, ChunkSize>::operator!=(const ChunkedList &other) const {
 }
 
 template<typename T, size_t ChunkSize>
-std::ostream &operator<<(std::ostream &os, ChunkedList<T, ChunkSize> &chunkedList) {
-  os << '[';
+void ChunkedList<T, ChunkSize>::save(std::ostream &os) const requires std::is_trivially_copyable_v<T> {
+  namespace snapshot = chunked_list_utility::snapshot;
+
+  static_assert(alignof(T) <= sizeof(snapshot::header), "Snapshot elements must be aligned to at most 64 bytes");
+
+  // the checksum is written before the elements, so they are read twice rather than seeking back in the stream
+  uint64_t checksum = snapshot::checksumSeed;
+
+  for (const std::span<const T> elements: chunks())
+    checksum = snapshot::checksum(elements.data(), elements.size_bytes(), checksum);
+
+  const snapshot::header header{
+    snapshot::magic, snapshot::version, snapshot::byteOrderMark, sizeof(T), alignof(T), ChunkSize, elementCount,
+    checksum, 0
+  };
+
+  os.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  for (const std::span<const T> elements: chunks())
+    os.write(reinterpret_cast<const char *>(elements.data()), static_cast<std::streamsize>(elements.size_bytes()));
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::save(const std::filesystem::path &path) const
+  requires std::is_trivially_copyable_v<T> {
+  std::ofstream file{};
+  file.exceptions(std::ios_base::failbit | std::ios_base::badbit);
+  file.open(path, std::ios_base::binary | std::ios_base::trunc);
+
+  save(file);
+  file.close();
+}
 
-  auto iterator = chunkedList.begin(), lastIterator = chunkedList.end() - 1;
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::formattedSize(const std::string_view delimiter) const
+  requires chunked_list_utility::formatting::to_chars_formattable<T> {
+  if (empty())
+    return 0;
+
+  size_t size = (elementCount - 1) * delimiter.size();
 
-  for (; iterator != lastIterator; ++iterator) {
-    os << *iterator << ", ";
+  for (const std::span<const T> elements: chunks()) {
+    for (const T element: elements)
+      size += chunked_list_utility::formatting::formatted_size(element);
   }
 
-  os << *lastIterator;
+  return size;
+}
+
+template<typename T, size_t ChunkSize>
+std::to_chars_result ChunkedList<T, ChunkSize>::formatTo(char *first, char *const last,
+                                                         const std::string_view delimiter) const
+  requires chunked_list_utility::formatting::to_chars_formattable<T> {
+  bool firstElement = true;
 
-  os << "]";
+  for (const std::span<const T> elements: chunks()) {
+    for (const T element: elements) {
+      if (!firstElement) {
+        if (static_cast<size_t>(last - first) < delimiter.size())
+          return {last, std::errc::value_too_large};
 
-  return os;
+        first = std::copy(delimiter.begin(), delimiter.end(), first);
+      }
+
+      firstElement = false;
+
+      const std::to_chars_result result = chunked_list_utility::formatting::format_element(first, last, element);
+
+      if (result.ec != std::errc{})
+        return result;
+
+      first = result.ptr;
+    }
+  }
+
+  return {first, std::errc{}};
 }
 
 template<typename T, size_t ChunkSize>
-template<typename OutputStream, typename BaseOutputStream, typename StringType, typename DelimiterType>
-StringType ChunkedList<T, ChunkSize>::concat(const DelimiterType delimiter) {
-  static_assert(chunked_list_utility::can_insert<BaseOutputStream, OutputStream, StringType>,
-                "OutputStream cannot handle StringType");
-  static_assert(chunked_list_utility::can_insert<BaseOutputStream, OutputStream, StringType>,
-                "OutputStream cannot handle SeparatorType");
+void ChunkedList<T, ChunkSize>::formatTo(std::string &output, const std::string_view delimiter) const
+  requires chunked_list_utility::formatting::to_chars_formattable<T> {
+  using chunked_list_utility::formatting::max_chars;
+
+  // sizing integers exactly is cheaper than formatting them, whereas floating-point types would be formatted twice
+  const size_t formattedBound = std::is_integral_v<T>
+                                  ? formattedSize(delimiter)
+                                  : elementCount * (max_chars<T> + delimiter.size());
+
+  const size_t offset = output.size();
+  output.resize(offset + formattedBound);
 
-  OutputStream stream;
+  const std::to_chars_result result = formatTo(output.data() + offset, output.data() + output.size(), delimiter);
+  output.resize(static_cast<size_t>(result.ptr - output.data()));
+}
+
+template<typename T, size_t ChunkSize>
+std::ostream &operator<<(std::ostream &os, const ChunkedList<T, ChunkSize> &chunkedList) {
+  if constexpr (chunked_list_utility::formatting::to_chars_formattable<T>) {
+    // a stream whose formatting state has been changed inserts each element itself, so that the state is honoured
+    if (chunked_list_utility::formatting::formats_as_to_chars<T>(os)) {
+      chunked_list_utility::formatting::write_buffered(chunkedList, "[", ", ", "]", [&os](const std::string_view text) {
+        os.write(text.data(), static_cast<std::streamsize>(text.size()));
+      }, static_cast<int>(os.precision()));
+
+      return os;
+    }
+  }
+
+  // the width applies to each element rather than to the opening bracket, which would otherwise consume it
+  const std::streamsize width = os.width(0);
+  os << '[';
 
-  Iterator it = begin(), lastIt = end() - 1;
+  for (auto iterator = chunkedList.begin(); iterator != chunkedList.end(); ++iterator) {
+    if (iterator != chunkedList.begin())
+      os << ", ";
+
+    os.width(width);
+    os << *iterator;
+  }
+
+  os << ']';
+
+  return os;
+}
+
+#ifdef __cpp_lib_format
+template<typename T, size_t ChunkSize>
+constexpr std::format_parse_context::iterator std::formatter<ChunkedList<T, ChunkSize>, char>::parse(
+  std::format_parse_context &ctx) {
+  auto iterator = ctx.begin();
 
-  if (it == lastIt) {
-    DEBUG_LOG("Empty ChunkedList" << std::endl)
-    return StringType{};
+  if (iterator != ctx.end() && *iterator == 'n') {
+    brackets = false;
+    ++iterator;
   }
 
-  for (; it != lastIt; ++it) {
-    stream << *it << delimiter;
+  if (iterator != ctx.end() && *iterator != '}')
+    throw std::format_error{"Invalid format specifier for ChunkedList"};
 
-    DEBUG_LOG(stream.str() << '\n');
+  return iterator;
+}
+
+template<typename T, size_t ChunkSize>
+template<typename FormatContext>
+typename FormatContext::iterator std::formatter<ChunkedList<T, ChunkSize>, char>::format(
+  const ChunkedList<T, ChunkSize> &chunkedList, FormatContext &ctx) const {
+  auto output = ctx.out();
+  const std::string_view prefix = brackets ? "[" : "", suffix = brackets ? "]" : "";
+
+  if constexpr (chunked_list_utility::formatting::to_chars_formattable<T>) {
+    chunked_list_utility::formatting::write_buffered(chunkedList, prefix, ", ", suffix,
+                                                     [&output](const std::string_view text) {
+                                                       output = std::ranges::copy(text, output).out;
+                                                     });
+  } else {
+    output = std::ranges::copy(prefix, output).out;
+
+    for (auto iterator = chunkedList.begin(); iterator != chunkedList.end(); ++iterator) {
+      if (iterator != chunkedList.begin())
+        output = std::ranges::copy(std::string_view{", "}, output).out;
+
+      output = std::format_to(output, "{}", *iterator);
+    }
+
+    output = std::ranges::copy(suffix, output).out;
   }
 
-  stream << *lastIt;
+  return output;
+}
+#endif
+
+template<typename T, size_t ChunkSize>
+template<typename OutputStream, typename BaseOutputStream, typename StringType, typename DelimiterType>
+StringType ChunkedList<T, ChunkSize>::concat(const DelimiterType delimiter) const {
+  if constexpr (chunked_list_utility::formatting::to_chars_formattable<T> && std::is_same_v<StringType, std::string>
+                && std::is_convertible_v<const DelimiterType &, std::string_view>) {
+    std::string output{};
+    formatTo(output, delimiter);
+    return output;
+  } else {
+    static_assert(chunked_list_utility::can_insert<BaseOutputStream, OutputStream, StringType>,
+                  "OutputStream cannot handle StringType");
+    static_assert(chunked_list_utility::can_insert<BaseOutputStream, OutputStream, DelimiterType>,
+                  "OutputStream cannot handle SeparatorType");
+
+    OutputStream stream;
+
+    for (ConstIterator iterator = begin(); iterator != end(); ++iterator) {
+      if (iterator != begin())
+        stream << delimiter;
 
-  return stream.str();
+      stream << *iterator;
+    }
+
+    return stream.str();
+  }
 }
 
 template<typename T, size_t ChunkSize>
@@ -277,3 +1751,34 @@ typename ChunkedList<T, ChunkSize>::ConstIterator end(
   const ChunkedList<T, ChunkSize> &chunkedList) noexcept {
   return chunkedList.end();
 }
+
+template<typename T, size_t ChunkSize>
+void swap(ChunkedList<T, ChunkSize> &lhs, ChunkedList<T, ChunkSize> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+namespace chunked_list_utility::segmented {
+  template<chunked_range ChunkedListT, typename Function>
+  Function for_each(ChunkedListT &&chunkedList, Function function) {
+    for (const auto chunk: chunkedList.chunks()) {
+      for (auto &value: chunk)
+        function(value);
+    }
+
+    return function;
+  }
+
+  template<chunked_range ChunkedListT, std::weakly_incrementable OutputIterator>
+  OutputIterator copy(const ChunkedListT &chunkedList, OutputIterator output) {
+    for (const auto chunk: chunkedList.chunks())
+      output = std::ranges::copy(chunk, std::move(output)).out;
+
+    return output;
+  }
+
+  template<chunked_range ChunkedListT>
+  void fill(ChunkedListT &chunkedList, const std::ranges::range_value_t<ChunkedListT> &value) {
+    for (const auto chunk: chunkedList.chunks())
+      std::ranges::fill(chunk, value);
+  }
+}
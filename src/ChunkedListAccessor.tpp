@@ -9,10 +9,10 @@ size_t ChunkedListAccessor<T, ChunkSize>::getChunkCount() {
 
 template<typename T, size_t ChunkSize>
 typename ChunkedListAccessor<T, ChunkSize>::Chunk *ChunkedListAccessor<T, ChunkSize>::getFront() {
-  return this->front;
+  return this->frontChunk;
 }
 
 template<typename T, size_t ChunkSize>
 typename ChunkedListAccessor<T, ChunkSize>::Chunk *ChunkedListAccessor<T, ChunkSize>::getBack() {
-  return this->back;
+  return this->backChunk;
 }
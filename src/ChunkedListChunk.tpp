@@ -13,16 +13,25 @@ ChunkedList<T, ChunkSize>::Chunk::Chunk(const T *array, const size_t size, Chunk
                                                             nextChunk(nextChunk),
                                                             prevChunk(prevChunk) {
   DEBUG_LOG("range = " << size << ": ")
-  for (int index = 0; index < size; ++index) {
-    data[index] = array[index];
-    DEBUG_LOG(array[index] << ", ")
-  }
+  std::uninitialized_copy_n(array, size, slot(0));
+
+  DEBUG_EXECUTE({
+    for (size_t index = 0; index < size; ++index) {
+      DEBUG_LOG(array[index] << ", ")
+    }
+  })
 
   DEBUG_LINE(true)
 }
 
 template<typename T, size_t ChunkSize>
-ChunkedList<T, ChunkSize>::Chunk::Chunk(T value) : data{std::move(value)}, nextIndex{1} {
+ChunkedList<T, ChunkSize>::Chunk::Chunk(T value) {
+  emplace(std::move(value));
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::Chunk::~Chunk() {
+  clear();
 }
 
 template<typename T, size_t ChunkSize>
@@ -42,24 +51,198 @@ ChunkedList<T, ChunkSize>::Chunk::operator-(const size_t offset) {
   Chunk *chunk{this};
 
   for (size_t i = 0; i < offset; ++i)
-    chunk = chunk->nextChunk;
+    chunk = chunk->prevChunk;
 
   return *chunk;
 }
 
 template<typename T, size_t ChunkSize>
 bool ChunkedList<T, ChunkSize>::Chunk::empty() const {
-  return nextIndex == 0;
+  return nextIndex == startIndex;
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::Chunk::size() const {
+  return nextIndex - startIndex;
+}
+
+template<typename T, size_t ChunkSize>
+template<typename... Args>
+T &ChunkedList<T, ChunkSize>::Chunk::emplace(Args &&... args) {
+  T *element = std::construct_at(slot(nextIndex), std::forward<Args>(args)...);
+  ++nextIndex;
+  return *element;
+}
+
+template<typename T, size_t ChunkSize>
+template<typename... Args>
+T &ChunkedList<T, ChunkSize>::Chunk::emplaceFront(Args &&... args) {
+  T *element = std::construct_at(slot(startIndex - 1), std::forward<Args>(args)...);
+  --startIndex;
+  return *element;
+}
+
+template<typename T, size_t ChunkSize>
+template<typename InputIterator>
+InputIterator ChunkedList<T, ChunkSize>::Chunk::append(InputIterator first, const size_t count) {
+  if constexpr (std::contiguous_iterator<InputIterator> && std::is_trivially_copyable_v<T>
+                && std::is_same_v<std::iter_value_t<InputIterator>, T>) {
+    std::memcpy(slot(nextIndex), std::to_address(first), count * sizeof(T));
+    first += count;
+  } else {
+    first = std::ranges::uninitialized_copy_n(first, count, slot(nextIndex), slot(ChunkSize)).in;
+  }
+
+  nextIndex += count;
+  return first;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::Chunk::appendDefault(const size_t count) {
+  std::uninitialized_value_construct_n(slot(nextIndex), count);
+  nextIndex += count;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::Chunk::appendCopies(const size_t count, const T &value) {
+  std::uninitialized_fill_n(slot(nextIndex), count, value);
+  nextIndex += count;
+}
+
+template<typename T, size_t ChunkSize>
+template<typename... Args>
+T &ChunkedList<T, ChunkSize>::Chunk::insert(const size_t index, Args &&... args) {
+  if (index == nextIndex)
+    return emplace(std::forward<Args>(args)...);
+
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    T value(std::forward<Args>(args)...);
+    std::memmove(slot(index + 1), slot(index), (nextIndex - index) * sizeof(T));
+    ++nextIndex;
+    return *std::construct_at(slot(index), std::move(value));
+  } else {
+    T value(std::forward<Args>(args)...);
+    std::construct_at(slot(nextIndex), std::move((*this)[nextIndex - 1]));
+    ++nextIndex;
+    std::move_backward(&(*this)[index], &(*this)[nextIndex - 2], &(*this)[nextIndex - 1]);
+    return (*this)[index] = std::move(value);
+  }
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::Chunk::erase(const size_t index, const size_t count) {
+  if (count == 0)
+    return;
+
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::memmove(slot(index), slot(index + count), (nextIndex - index - count) * sizeof(T));
+  } else {
+    std::move(&(*this)[0] + index + count, &(*this)[0] + nextIndex, &(*this)[index]);
+    std::destroy_n(&(*this)[nextIndex - count], count);
+  }
+
+  nextIndex -= count;
+
+  if (nextIndex == startIndex)
+    nextIndex = startIndex = 0;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::Chunk::moveElementsTo(Chunk &destination, const size_t index) {
+  const size_t count = nextIndex - index;
+
+  if (count == 0)
+    return;
+
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::memcpy(destination.slot(destination.nextIndex), slot(index), count * sizeof(T));
+  } else {
+    std::uninitialized_move_n(&(*this)[index], count, destination.slot(destination.nextIndex));
+    std::destroy_n(&(*this)[index], count);
+  }
+
+  destination.nextIndex += count;
+  nextIndex = index;
+
+  if (nextIndex == startIndex)
+    nextIndex = startIndex = 0;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::Chunk::pop() {
+  --nextIndex;
+  std::destroy_at(&(*this)[nextIndex]);
+
+  if (nextIndex == startIndex)
+    nextIndex = startIndex = 0;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::Chunk::popFront(const size_t count) {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    std::destroy_n(&(*this)[startIndex], count);
+  }
+
+  startIndex += count;
+
+  // an emptied Chunk is filled from the start of its storage again
+  if (nextIndex == startIndex)
+    nextIndex = startIndex = 0;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::Chunk::compact() {
+  if (startIndex == 0)
+    return;
+
+  const size_t count = size();
+
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::memmove(slot(0), slot(startIndex), count * sizeof(T));
+  } else {
+    // moving in order means each slot is either unconstructed or already moved from and destroyed when it is reached
+    for (size_t index = 0; index < count; ++index) {
+      std::construct_at(slot(index), std::move((*this)[startIndex + index]));
+      std::destroy_at(&(*this)[startIndex + index]);
+    }
+  }
+
+  startIndex = 0;
+  nextIndex = count;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::Chunk::clear() {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    std::destroy_n(&(*this)[startIndex], nextIndex - startIndex);
+  }
+
+  startIndex = nextIndex = 0;
+}
+
+template<typename T, size_t ChunkSize>
+T *ChunkedList<T, ChunkSize>::Chunk::slot(const size_t index) {
+  return reinterpret_cast<T *>(data + index * sizeof(T));
 }
 
 template<typename T, size_t ChunkSize>
 T &ChunkedList<T, ChunkSize>::Chunk::operator[](size_t index) {
-  return data[index];
+  return *std::launder(reinterpret_cast<T *>(data + index * sizeof(T)));
 }
 
 template<typename T, size_t ChunkSize>
 const T &ChunkedList<T, ChunkSize>::Chunk::operator[](size_t index) const {
-  return data[index];
+  return *std::launder(reinterpret_cast<const T *>(data + index * sizeof(T)));
+}
+
+template<typename T, size_t ChunkSize>
+std::span<T> ChunkedList<T, ChunkSize>::Chunk::elements() {
+  return {&(*this)[startIndex], size()};
+}
+
+template<typename T, size_t ChunkSize>
+std::span<const T> ChunkedList<T, ChunkSize>::Chunk::elements() const {
+  return {&(*this)[startIndex], size()};
 }
 
 template<typename T, size_t ChunkSize>
@@ -75,7 +258,7 @@ bool ChunkedList<T, ChunkSize>::Chunk::operator!=(const Chunk &other) const {
 template<typename T, size_t ChunkSize>
 void ChunkedList<T, ChunkSize>::Chunk::debugData(std::string &str) const {
   std::ostringstream oss{};
-  oss << "ChunkedList<" << typeid(T).name() << ", " << std::to_string(ChunkSize) << ">::Chunk(nextIndex=" << nextIndex
+  oss << "ChunkedList<" << typeid(T).name() << ", " << std::to_string(ChunkSize) << ">::Chunk(startIndex=" << startIndex << ", nextIndex=" << nextIndex
   << ", nextChunk=" << nextChunk <<
   ", prevChunk = " << prevChunk;
 
@@ -84,16 +267,45 @@ void ChunkedList<T, ChunkSize>::Chunk::debugData(std::string &str) const {
   } {
     oss << ", data=[";
 
-    size_t index = 0;
+    size_t index = startIndex;
 
     for (; index < nextIndex - 1; ++index) {
-      oss << data[index] << ", ";
+      oss << (*this)[index] << ", ";
     }
 
-    oss << data[index] << ']';
+    oss << (*this)[index] << ']';
   }
 
 end:
   oss << ')';
   str = oss.str();
 }
+
+#ifdef CHUNKED_LIST_COUNTERS
+template<typename T, size_t ChunkSize>
+void *ChunkedList<T, ChunkSize>::Chunk::operator new(const size_t size) {
+  void *pointer = ::operator new(size);
+  COUNTER_ADD(chunkAllocations, 1)
+  return pointer;
+}
+
+template<typename T, size_t ChunkSize>
+void *ChunkedList<T, ChunkSize>::Chunk::operator new(const size_t size, const std::align_val_t alignment) {
+  void *pointer = ::operator new(size, alignment);
+  COUNTER_ADD(chunkAllocations, 1)
+  return pointer;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::Chunk::operator delete(void *pointer, const size_t size) {
+  COUNTER_ADD(chunkDeallocations, 1)
+  ::operator delete(pointer, size);
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::Chunk::operator delete(void *pointer, const size_t size,
+                                                       const std::align_val_t alignment) {
+  COUNTER_ADD(chunkDeallocations, 1)
+  ::operator delete(pointer, size, alignment);
+}
+#endif
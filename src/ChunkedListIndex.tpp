@@ -0,0 +1,355 @@
+#pragma once
+
+#include "ChunkedList.hpp"
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::allocateNode(Chunk *chunk, const size_t slots) {
+  // splitmix64, which is plenty random for balancing and keeps the ChunkIndex free of any global state
+  uint64_t priority = seed += 0x9e3779b97f4a7c15;
+  priority = (priority ^ priority >> 30) * 0xbf58476d1ce4e5b9;
+  priority = (priority ^ priority >> 27) * 0x94d049bb133111eb;
+  priority ^= priority >> 31;
+
+  const Node node{chunk, none, none, none, slots, 1, slots, priority};
+
+  if (freeNode == none) {
+    nodes.push_back(node);
+    return nodes.size() - 1;
+  }
+
+  const size_t index = freeNode;
+  freeNode = nodes[index].parent;
+  nodes[index] = node;
+  return index;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkIndex::pull(const size_t node) {
+  Node &current = nodes[node];
+  current.subtreeChunks = 1 + countChunks(current.left) + countChunks(current.right);
+  current.subtreeSlots = current.slots + countSlots(current.left) + countSlots(current.right);
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkIndex::pullSubtree(const size_t node) {
+  if (node == none)
+    return;
+
+  pullSubtree(nodes[node].left);
+  pullSubtree(nodes[node].right);
+  pull(node);
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkIndex::rotateUp(const size_t node) {
+  const size_t parent = nodes[node].parent;
+  const size_t grandparent = nodes[parent].parent;
+
+  if (nodes[parent].left == node) {
+    nodes[parent].left = nodes[node].right;
+
+    if (nodes[node].right != none)
+      nodes[nodes[node].right].parent = parent;
+
+    nodes[node].right = parent;
+  } else {
+    nodes[parent].right = nodes[node].left;
+
+    if (nodes[node].left != none)
+      nodes[nodes[node].left].parent = parent;
+
+    nodes[node].left = parent;
+  }
+
+  nodes[parent].parent = node;
+  nodes[node].parent = grandparent;
+
+  if (grandparent == none)
+    root = node;
+  else if (nodes[grandparent].left == parent)
+    nodes[grandparent].left = node;
+  else
+    nodes[grandparent].right = node;
+
+  pull(parent);
+  pull(node);
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::leftmost(size_t node) const {
+  while (nodes[node].left != none)
+    node = nodes[node].left;
+
+  return node;
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::rightmost(size_t node) const {
+  while (nodes[node].right != none)
+    node = nodes[node].right;
+
+  return node;
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::countChunks(const size_t node) const {
+  return node == none ? 0 : nodes[node].subtreeChunks;
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::countSlots(const size_t node) const {
+  return node == none ? 0 : nodes[node].subtreeSlots;
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::build(Chunk *const *chunks, const size_t count) {
+  clear();
+  nodes.reserve(count);
+
+  // every node is linked in as the right child of the deepest node on the right spine with a higher priority, taking
+  // the rest of the spine below it as its left child, which builds the treap in amortised O(1) per node
+  size_t last = none;
+
+  for (size_t index = 0; index < count; ++index) {
+    const size_t node = allocateNode(chunks[index], index + 1 == count ? 0 : chunks[index]->nextIndex);
+    size_t child = none;
+    size_t parent = last;
+
+    while (parent != none && nodes[parent].priority < nodes[node].priority) {
+      child = parent;
+      parent = nodes[parent].parent;
+    }
+
+    nodes[node].left = child;
+    nodes[node].parent = parent;
+
+    if (child != none)
+      nodes[child].parent = node;
+
+    if (parent == none)
+      root = node;
+    else
+      nodes[parent].right = node;
+
+    last = node;
+  }
+
+  pullSubtree(root);
+  return count == 0 ? none : 0;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkIndex::clear() {
+  nodes.clear();
+  root = freeNode = none;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkIndex::reserve(const size_t count) {
+  // free nodes are only left behind once the nodes have been in use, so a new node is only ever pushed when every
+  // node is in use
+  nodes.reserve(count);
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::insertAfter(const size_t node, Chunk *chunk, const size_t slots) {
+  const size_t newNode = allocateNode(chunk, slots);
+
+  if (root == none) {
+    root = newNode;
+    return newNode;
+  }
+
+  // the new node becomes a leaf right after the given node in order, then rotates up past lower priorities
+  size_t parent;
+
+  if (node == none) {
+    parent = leftmost(root);
+    nodes[parent].left = newNode;
+  } else if (nodes[node].right == none) {
+    parent = node;
+    nodes[parent].right = newNode;
+  } else {
+    parent = leftmost(nodes[node].right);
+    nodes[parent].left = newNode;
+  }
+
+  nodes[newNode].parent = parent;
+
+  for (size_t ancestor = parent; ancestor != none; ancestor = nodes[ancestor].parent) {
+    ++nodes[ancestor].subtreeChunks;
+    nodes[ancestor].subtreeSlots += slots;
+  }
+
+  while (nodes[newNode].parent != none && nodes[nodes[newNode].parent].priority < nodes[newNode].priority)
+    rotateUp(newNode);
+
+  return newNode;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkIndex::erase(const size_t node) {
+  // the node rotates down below its higher priority child until it is a leaf, which is then simply detached
+  while (nodes[node].left != none || nodes[node].right != none) {
+    const size_t left = nodes[node].left;
+    const size_t right = nodes[node].right;
+
+    if (right == none || (left != none && nodes[left].priority > nodes[right].priority))
+      rotateUp(left);
+    else
+      rotateUp(right);
+  }
+
+  const size_t parent = nodes[node].parent;
+
+  if (parent == none)
+    root = none;
+  else if (nodes[parent].left == node)
+    nodes[parent].left = none;
+  else
+    nodes[parent].right = none;
+
+  for (size_t ancestor = parent; ancestor != none; ancestor = nodes[ancestor].parent) {
+    --nodes[ancestor].subtreeChunks;
+    nodes[ancestor].subtreeSlots -= nodes[node].slots;
+  }
+
+  nodes[node].parent = freeNode;
+  freeNode = node;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkIndex::setSlots(const size_t node, const size_t slots) {
+  for (size_t ancestor = node; ancestor != none; ancestor = nodes[ancestor].parent)
+    nodes[ancestor].subtreeSlots = nodes[ancestor].subtreeSlots - nodes[node].slots + slots;
+
+  nodes[node].slots = slots;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::ChunkIndex::recount() {
+  if (root == none)
+    return;
+
+  const size_t lastNode = last();
+
+  for (size_t node = first(); node != none; node = next(node))
+    nodes[node].slots = node == lastNode ? 0 : nodes[node].chunk->nextIndex;
+
+  pullSubtree(root);
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::size() const {
+  return countChunks(root);
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::slots() const {
+  return countSlots(root);
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::first() const {
+  return root == none ? none : leftmost(root);
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::last() const {
+  return root == none ? none : rightmost(root);
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::next(size_t node) const {
+  if (nodes[node].right != none)
+    return leftmost(nodes[node].right);
+
+  size_t parent = nodes[node].parent;
+
+  while (parent != none && nodes[parent].right == node) {
+    node = parent;
+    parent = nodes[parent].parent;
+  }
+
+  return parent;
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::rank(size_t node) const {
+  size_t rank = countChunks(nodes[node].left);
+
+  for (size_t parent = nodes[node].parent; parent != none; node = parent, parent = nodes[parent].parent) {
+    if (nodes[parent].right == node)
+      rank += countChunks(nodes[parent].left) + 1;
+  }
+
+  return rank;
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::slotsBefore(size_t node) const {
+  size_t slots = countSlots(nodes[node].left);
+
+  for (size_t parent = nodes[node].parent; parent != none; node = parent, parent = nodes[parent].parent) {
+    if (nodes[parent].right == node)
+      slots += countSlots(nodes[parent].left) + nodes[parent].slots;
+  }
+
+  return slots;
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::at(size_t rank) const {
+  size_t node = root;
+
+  while (true) {
+    const size_t leftChunks = countChunks(nodes[node].left);
+
+    if (rank == leftChunks)
+      return node;
+
+    if (rank < leftChunks) {
+      node = nodes[node].left;
+    } else {
+      rank -= leftChunks + 1;
+      node = nodes[node].right;
+    }
+  }
+}
+
+template<typename T, size_t ChunkSize>
+std::pair<size_t, size_t> ChunkedList<T, ChunkSize>::ChunkIndex::locate(size_t slot) const {
+  size_t node = root;
+
+  while (true) {
+    const size_t leftSlots = countSlots(nodes[node].left);
+
+    if (slot < leftSlots) {
+      node = nodes[node].left;
+      continue;
+    }
+
+    slot -= leftSlots;
+
+    if (slot < nodes[node].slots)
+      return {node, slot};
+
+    slot -= nodes[node].slots;
+    node = nodes[node].right;
+  }
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Chunk *&ChunkedList<T, ChunkSize>::ChunkIndex::chunk(const size_t node) {
+  return nodes[node].chunk;
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Chunk *ChunkedList<T, ChunkSize>::ChunkIndex::chunk(const size_t node) const {
+  return nodes[node].chunk;
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::ChunkIndex::allocatedBytes() const {
+  return nodes.capacity() * sizeof(Node);
+}
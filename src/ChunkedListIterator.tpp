@@ -1,5 +1,6 @@
 #pragma once
 #include "ChunkedList.hpp"
+#include "internal/ChunkedListMacros.hpp"
 
 // ---------------------------------------------------------------------------------------------------------------------
 // GenericIterator implementation
@@ -26,15 +27,11 @@ ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::GenericIterator(
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT, typename ValueT>
-typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT> ChunkedList<T, ChunkSize>::GenericIterator<
-  ChunkT, ValueT>::operator++() {
-  if (index < ChunkSize - 1) {
-    ++index;
-  } else if (chunkIterator->nextChunk) {
+typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT> &ChunkedList<T, ChunkSize>::
+GenericIterator<ChunkT, ValueT>::operator++() {
+  if (const ChunkT *chunk = chunkIterator.getChunk(); ++index == chunk->nextIndex && chunk->nextChunk) {
     ++chunkIterator;
     index = 0;
-  } else {
-    index = ChunkSize;
   }
 
   return *this;
@@ -51,11 +48,11 @@ typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT> Chu
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT, typename ValueT>
-typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT> ChunkedList<T, ChunkSize>::GenericIterator<
-  ChunkT, ValueT>::operator--() {
+typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT> &ChunkedList<T, ChunkSize>::
+GenericIterator<ChunkT, ValueT>::operator--() {
   if (index == 0) {
-    index = ChunkSize - 1;
     --chunkIterator;
+    index = chunkIterator.getChunk()->nextIndex - 1;
   } else {
     --index;
   }
@@ -67,7 +64,7 @@ template<typename T, size_t ChunkSize>
 template<typename ChunkT, typename ValueT>
 typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT> ChunkedList<T, ChunkSize>::GenericIterator<
   ChunkT, ValueT>::operator--(int) {
-  Iterator original = *this;
+  GenericIterator original = *this;
   operator--();
   return original;
 }
@@ -75,98 +72,131 @@ typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT> Chu
 template<typename T, size_t ChunkSize>
 template<typename ChunkT, typename ValueT>
 typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT>
-ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator+(size_t offset) {
-  size_t chunkOffset = offset / ChunkSize;
-  offset %= ChunkSize;
+ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator+(const difference_type offset) const {
+  GenericIterator iterator = *this;
+  return iterator += offset;
+}
 
-  const size_t iteratorIndex = index + offset;
+template<typename T, size_t ChunkSize>
+template<typename ChunkT, typename ValueT>
+typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT>
+ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator-(const difference_type offset) const {
+  GenericIterator iterator = *this;
+  return iterator += -offset;
+}
 
-  if (iteratorIndex >= ChunkSize) {
-    return GenericIterator{chunkIterator + (chunkOffset + 1), iteratorIndex - ChunkSize};
+template<typename T, size_t ChunkSize>
+template<typename ChunkT, typename ValueT>
+typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT>::difference_type
+ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator-(const GenericIterator &other) const {
+  // iterators in the same Chunk, including those of a ChunkedList a move left without any Chunk, only differ in index
+  if (chunkIterator.getChunk() == other.chunkIterator.getChunk())
+    return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+
+  if (const ChunkDirectory &directory = *chunkIterator.getDirectory(); !directory.dense) {
+    // the slots before each Chunk are counted through the ChunkIndex, as partially filled Chunks are in the middle
+    const size_t slot = directory.slotsBefore(chunkIterator.getChunk()) + index;
+    const size_t otherSlot = directory.slotsBefore(other.chunkIterator.getChunk()) + other.index;
+    return static_cast<difference_type>(slot) - static_cast<difference_type>(otherSlot);
   }
 
-  return GenericIterator{chunkIterator + chunkOffset, iteratorIndex};
+  const auto chunkOffset = static_cast<difference_type>(chunkIterator.getChunk()->position
+                                                        - other.chunkIterator.getChunk()->position);
+  return chunkOffset * static_cast<difference_type>(ChunkSize)
+         + static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT, typename ValueT>
-typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT>
-ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator-(size_t offset) {
-  // size_t chunkOffset = offset / ChunkSize;
-  // offset %= ChunkSize;
-  //
-  // if (offset > iterator.getIndex()) {
-  //   return Iterator{iterator.getChunkIterator() - (chunkOffset + 1), ChunkSize + iterator.getIndex() - offset};
-  // }
-  //
-  // return Iterator{iterator.getChunkIterator() - chunkOffset, iterator.getIndex() - offset};
-
-  auto chunkIt = chunkIterator;
-
-  while (offset > ChunkSize) {
-    --chunkIt;
-    offset -= ChunkSize;
+typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT> &
+ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator+=(const difference_type offset) {
+  constexpr auto chunkSize = static_cast<difference_type>(ChunkSize);
+
+  difference_type target = static_cast<difference_type>(index) + offset;
+
+  if (const ChunkDirectory &directory = *chunkIterator.getDirectory(); !directory.dense) {
+    // partially filled Chunks in the middle mean the Chunk is found by its slots through the ChunkIndex
+    if (target < 0 || target >= static_cast<difference_type>(chunkIterator.getChunk()->nextIndex)) {
+      const auto [chunk, slot] = directory.locate(directory.slotsBefore(chunkIterator.getChunk()) + target);
+      chunkIterator = ChunkIteratorT{chunk, chunkIterator.getList()};
+      target = static_cast<difference_type>(slot);
+    }
+
+    index = target;
+    return *this;
+  }
+
+  if (target >= 0 && target < chunkSize) {
+    index = target;
+    return *this;
+  }
+
+  difference_type chunkOffset = target / chunkSize;
+  difference_type newIndex = target % chunkSize;
+
+  if (newIndex < 0) {
+    newIndex += chunkSize;
+    --chunkOffset;
   }
 
-  if (offset > index) {
-    --chunkIt;
-    return GenericIterator{chunkIt, ChunkSize - offset + index};
+  const ChunkDirectory &directory = *chunkIterator.getDirectory();
+  size_t directoryIndex = chunkIterator.getDirectoryIndex() + chunkOffset;
+
+  // the position after a full back Chunk is referenced by the back Chunk, rather than by a missing Chunk
+  if (directoryIndex == directory.size()) {
+    --directoryIndex;
+    newIndex += chunkSize;
   }
 
-  return GenericIterator{chunkIt, index - offset};
+  chunkIterator = ChunkIteratorT{directory[directoryIndex], chunkIterator.getList()};
+  index = newIndex;
+
+  return *this;
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT, typename ValueT>
-typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT>
-ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator+=(const size_t offset) {
-  return *this = operator+(offset);
+typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT> &
+ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator-=(const difference_type offset) {
+  return *this += -offset;
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT, typename ValueT>
-typename ChunkedList<T, ChunkSize>::template GenericIterator<ChunkT, ValueT>
-ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator-=(const size_t offset) {
-  return *this = operator-(offset);
+ValueT &ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator[](const difference_type offset) const {
+  return *(*this + offset);
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT, typename ValueT>
-template<typename IteratorT>
+template<typename IteratorT> requires chunked_list_utility::is_generic_iterator<ChunkedList<T, ChunkSize>, IteratorT>
 bool ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator==(const IteratorT other) const {
-  static_assert(chunked_list_utility::is_generic_iterator<ChunkedList, IteratorT>, "IteratorT must be a GenericIterator!");
-  return chunkIterator == other.getChunkIterator() && index == other.getIndex();
+  return index == other.getIndex() && chunkIterator == other.getChunkIterator();
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT, typename ValueT>
-template<typename IteratorT>
+template<typename IteratorT> requires chunked_list_utility::is_generic_iterator<ChunkedList<T, ChunkSize>, IteratorT>
 bool ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator!=(const IteratorT other) const {
-  static_assert(chunked_list_utility::is_generic_iterator<ChunkedList, IteratorT>, "IteratorT must be a GenericIterator!");
-  return chunkIterator != other.getChunkIterator() || index != other.getIndex();
+  return index != other.getIndex() || chunkIterator != other.getChunkIterator();
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT, typename ValueT>
-ValueT &ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator*() {
-  return (*chunkIterator)[index];
+std::strong_ordering ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator<=>(
+  const GenericIterator &other) const {
+  return *this - other <=> 0;
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT, typename ValueT>
-const ValueT &ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator*() const {
+ValueT &ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator*() const {
   return (*chunkIterator)[index];
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT, typename ValueT>
-ValueT *ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator->() {
-  return &(*chunkIterator)[index];
-}
-
-template<typename T, size_t ChunkSize>
-template<typename ChunkT, typename ValueT>
-const ValueT *ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator->() const {
+ValueT *ChunkedList<T, ChunkSize>::GenericIterator<ChunkT, ValueT>::operator->() const {
   return &(*chunkIterator)[index];
 }
 
@@ -189,39 +219,42 @@ GenericIterator<ChunkT, ValueT>::getChunkIterator() const {
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::GenericChunkIterator(ChunkT *chunkPtr)
-  : chunk{chunkPtr} {
+ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::GenericChunkIterator(ChunkT *chunkPtr, ListT *list)
+  : chunk{chunkPtr}, list{list} {
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::GenericChunkIterator(ChunkT &chunkRef)
-  : chunk{&chunkRef} {
+ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::GenericChunkIterator(ChunkT &chunkRef, ListT *list)
+  : chunk{&chunkRef}, list{list} {
 }
 
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT>
+inline typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT> &
 ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator++() {
   chunk = chunk->nextChunk;
+  prefetchAhead(chunk, getDirectory());
+  COUNTER_ADD(chunkHops, 1)
   return *this;
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT>
+inline typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT>
 ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator++(int) {
-  Iterator original = *this;
-  chunk = chunk->nextChunk;
+  GenericChunkIterator original = *this;
+  ++*this;
   return original;
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT>
+typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT> &
 ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator--() {
-  chunk = chunk->prevChunk;
+  chunk = chunk ? chunk->prevChunk : getDirectory()->back();
+  COUNTER_ADD(chunkHops, 1)
   return *this;
 }
 
@@ -230,84 +263,121 @@ template<typename ChunkT>
 typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT>
 ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator--(int) {
   GenericChunkIterator original = *this;
-  chunk = chunk->prevChunk;
+  operator--();
   return original;
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
 typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT>
-ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator+(size_t offset) const {
-  ChunkT *ptr{chunk};
-
-  for (; offset > 0; --offset)
-    ptr = ptr->nextChunk;
-
-  return GenericChunkIterator{ptr};
+ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator+(const difference_type offset) const {
+  GenericChunkIterator iterator = *this;
+  return iterator += offset;
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
 typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT>
-ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator-(size_t offset) const {
-  ChunkT *ptr{chunk};
+ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator-(const difference_type offset) const {
+  GenericChunkIterator iterator = *this;
+  return iterator += -offset;
+}
 
-  for (; offset > 0; --offset)
-    ptr = ptr->prevChunk;
+template<typename T, size_t ChunkSize>
+template<typename ChunkT>
+typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT>::difference_type
+ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator-(const GenericChunkIterator &other) const {
+  return static_cast<difference_type>(getDirectoryIndex() - other.getDirectoryIndex());
+}
 
-  return GenericChunkIterator{ptr};
+template<typename T, size_t ChunkSize>
+template<typename ChunkT>
+typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT> &
+ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator+=(const difference_type offset) {
+  const ChunkDirectory *directory = getDirectory();
+  const size_t directoryIndex = getDirectoryIndex() + offset;
+  chunk = directoryIndex == directory->size() ? nullptr : (*directory)[directoryIndex];
+  return *this;
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT>
-ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator+=(const size_t offset) {
-  return *this = operator+(offset);
+typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT> &
+ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator-=(const difference_type offset) {
+  return *this += -offset;
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT>
-ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator-=(const size_t offset) {
-  return *this = operator-(offset);
+ChunkT &ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator[](const difference_type offset) const {
+  return *(*this + offset);
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-template<typename ChunkIteratorT>
+template<typename ChunkIteratorT> requires chunked_list_utility::is_generic_chunk_iterator<ChunkedList<T, ChunkSize>, ChunkIteratorT>
 bool ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator==(const ChunkIteratorT other) const {
-  static_assert(chunked_list_utility::is_generic_chunk_iterator<ChunkedList, ChunkIteratorT>, "ChunkIteratorT must be a GenericChunkIterator!");
-  return chunk == &*other;
+  // an iterator left on a Chunk which another iterator replaced with its copy is still at the copy's position
+  const auto *otherChunk = other.getChunk();
+  return chunk == otherChunk || (chunk && otherChunk && chunk->position == otherChunk->position);
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-template<typename ChunkIteratorT>
+template<typename ChunkIteratorT> requires chunked_list_utility::is_generic_chunk_iterator<ChunkedList<T, ChunkSize>, ChunkIteratorT>
 bool ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator!=(const ChunkIteratorT other) const {
-  static_assert(chunked_list_utility::is_generic_chunk_iterator<ChunkedList, ChunkIteratorT>, "ChunkIteratorT must be a GenericChunkIterator!");
-  return chunk != &*other;
+  return !(*this == other);
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-ChunkT &ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator*() {
-  return *chunk;
+std::strong_ordering ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator<=>(
+  const GenericChunkIterator &other) const {
+  return *this - other <=> 0;
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-const ChunkT &ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator*() const {
-  return *chunk;
+ChunkT &ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator*() const {
+  return *operator->();
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-ChunkT *ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator->() {
+ChunkT *ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator->() const {
+  // the Chunk may be modified through the reference, so a shared one is copied on the first access rather than when
+  // the iterator is obtained, which leaves reading through a non-const ChunkedList's iterators free
+  if constexpr (!std::is_const_v<ChunkT>) {
+    if (list)
+      chunk = list->writableIteratorChunk(chunk);
+  }
+
   return chunk;
 }
 
 template<typename T, size_t ChunkSize>
 template<typename ChunkT>
-const ChunkT *ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::operator->() const {
+ChunkT *ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::getChunk() const {
   return chunk;
 }
+
+template<typename T, size_t ChunkSize>
+template<typename ChunkT>
+typename ChunkedList<T, ChunkSize>::template GenericChunkIterator<ChunkT>::ListT *
+ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::getList() const {
+  return list;
+}
+
+template<typename T, size_t ChunkSize>
+template<typename ChunkT>
+const typename ChunkedList<T, ChunkSize>::ChunkDirectory *
+ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::getDirectory() const {
+  return list ? &list->chunkDirectory : nullptr;
+}
+
+template<typename T, size_t ChunkSize>
+template<typename ChunkT>
+size_t ChunkedList<T, ChunkSize>::GenericChunkIterator<ChunkT>::getDirectoryIndex() const {
+  const ChunkDirectory *directory = getDirectory();
+  return chunk ? directory->indexOf(chunk) : directory->size();
+}
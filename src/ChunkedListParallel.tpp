@@ -0,0 +1,304 @@
+#pragma once
+
+#include <algorithm>
+#include <optional>
+
+#include "ChunkedListParallel.hpp"
+
+namespace chunked_list_utility::parallel {
+  // -------------------------------------------------------------------------------------------------------------------
+  // thread_pool implementation
+  // -------------------------------------------------------------------------------------------------------------------
+
+  inline thread_pool::thread_pool(const size_t threadCount) {
+    // a pool without workers still has a queue, from which the thread calling run takes every task
+    for (size_t index = 0; index < std::max<size_t>(threadCount, 1); ++index)
+      queues.push_back(std::make_unique<WorkerQueue>());
+
+    for (size_t index = 0; index < threadCount; ++index)
+      workers.emplace_back(&thread_pool::workerLoop, this, index);
+  }
+
+  inline thread_pool::~thread_pool() {
+    {
+      std::lock_guard lock{sleepMutex};
+      stopping = true;
+    }
+
+    sleepCondition.notify_all();
+
+    for (std::thread &worker: workers)
+      worker.join();
+  }
+
+  inline bool thread_pool::runTask(const size_t queueIndex) {
+    Task task{};
+
+    {
+      WorkerQueue &queue = *queues[queueIndex];
+      std::lock_guard lock{queue.mutex};
+
+      if (!queue.tasks.empty()) {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      }
+    }
+
+    for (size_t offset = 1; !task && offset < queues.size(); ++offset) {
+      WorkerQueue &queue = *queues[(queueIndex + offset) % queues.size()];
+      std::lock_guard lock{queue.mutex};
+
+      if (!queue.tasks.empty()) {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      }
+    }
+
+    if (!task)
+      return false;
+
+    queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+    task();
+    return true;
+  }
+
+  inline void thread_pool::workerLoop(const size_t queueIndex) {
+    currentQueue = queueIndex;
+
+    while (true) {
+      if (runTask(queueIndex))
+        continue;
+
+      std::unique_lock lock{sleepMutex};
+      sleepCondition.wait(lock, [this] { return stopping || queuedTasks.load() > 0; });
+
+      if (stopping && queuedTasks.load() == 0)
+        return;
+    }
+  }
+
+  inline size_t thread_pool::concurrency() const {
+    return workers.size() + 1;
+  }
+
+  template<typename Function>
+  void thread_pool::run(const size_t taskCount, Function function) {
+    if (taskCount == 0)
+      return;
+
+    if (taskCount == 1) {
+      function(size_t{0});
+      return;
+    }
+
+    std::atomic<size_t> remainingTasks{taskCount};
+
+    std::exception_ptr exception{};
+    std::mutex exceptionMutex{};
+
+    // the tasks are counted before they are queued, so that the count never drops below zero when one is taken
+    {
+      std::lock_guard lock{sleepMutex};
+      queuedTasks += taskCount;
+    }
+
+    const size_t firstQueue = nextQueue.fetch_add(taskCount, std::memory_order_relaxed);
+
+    for (size_t task = 0; task < taskCount; ++task) {
+      WorkerQueue &queue = *queues[(firstQueue + task) % queues.size()];
+      std::lock_guard lock{queue.mutex};
+
+      queue.tasks.emplace_back([&, task] {
+        try {
+          function(task);
+        } catch (...) {
+          std::lock_guard exceptionLock{exceptionMutex};
+
+          if (!exception)
+            exception = std::current_exception();
+        }
+
+        remainingTasks.fetch_sub(1, std::memory_order_release);
+      });
+    }
+
+    sleepCondition.notify_all();
+
+    // the waiting thread runs tasks too, so that tasks which call run themselves can't deadlock the pool
+    while (remainingTasks.load(std::memory_order_acquire) > 0) {
+      if (!runTask(currentQueue % queues.size()))
+        std::this_thread::yield();
+    }
+
+    if (exception)
+      std::rethrow_exception(exception);
+  }
+
+  inline thread_pool &thread_pool::global() {
+    static thread_pool pool{std::max(std::thread::hardware_concurrency(), 1u) - 1};
+    return pool;
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------
+  // Parallel algorithm implementations
+  // -------------------------------------------------------------------------------------------------------------------
+
+  template<typename ChunkedListT, executor Executor>
+  size_t chunk_task_count(const ChunkedListT &chunkedList, Executor &executor) {
+    constexpr size_t tasksPerThread = 4;
+
+    const auto chunkCount = static_cast<size_t>(chunkedList.endChunk() - chunkedList.beginChunk());
+    return std::min(chunkCount, executor.concurrency() * tasksPerThread);
+  }
+
+  template<typename ChunkedListT, typename Function, executor Executor>
+  void run_chunk_tasks(ChunkedListT &chunkedList, const size_t taskCount, Function function, Executor &executor) {
+    if constexpr (!std::is_const_v<ChunkedListT>) {
+      // Chunks shared with a Snapshot are copied on the first access through an iterator, which is done here up front
+      // rather than by tasks racing to relink the copies
+      for (auto chunkIt = chunkedList.beginChunk(); chunkIt != chunkedList.endChunk(); ++chunkIt)
+        static_cast<void>(*chunkIt);
+    }
+
+    const auto beginChunk = chunkedList.beginChunk();
+    const auto chunkCount = static_cast<size_t>(chunkedList.endChunk() - beginChunk);
+
+    executor.run(taskCount, [&](const size_t task) {
+      const auto first = static_cast<std::ptrdiff_t>(chunkCount * task / taskCount);
+      const auto last = static_cast<std::ptrdiff_t>(chunkCount * (task + 1) / taskCount);
+
+      function(beginChunk + first, beginChunk + last, task);
+    });
+  }
+
+  template<typename T, size_t ChunkSize, typename Function, executor Executor>
+  void for_each(ChunkedList<T, ChunkSize> &chunkedList, Function function, Executor &executor) {
+    const size_t taskCount = chunk_task_count(chunkedList, executor);
+
+    run_chunk_tasks(chunkedList, taskCount, [&function](auto first, const auto last, size_t) {
+      for (; first != last; ++first) {
+        if (first->empty()) continue;
+
+        for (T &element: first->elements())
+          function(element);
+      }
+    }, executor);
+  }
+
+  template<typename T, size_t ChunkSize, typename UnaryOperation, executor Executor>
+  void transform(ChunkedList<T, ChunkSize> &chunkedList, UnaryOperation operation, Executor &executor) {
+    parallel::for_each(chunkedList, [&operation](T &element) { element = operation(element); }, executor);
+  }
+
+  template<typename T, size_t ChunkSize, typename ResultT, typename BinaryOperation, executor Executor>
+  ResultT reduce(const ChunkedList<T, ChunkSize> &chunkedList, ResultT init, BinaryOperation operation,
+                 Executor &executor) {
+    const size_t taskCount = chunk_task_count(chunkedList, executor);
+
+    std::vector<std::optional<ResultT> > partialResults(taskCount);
+
+    run_chunk_tasks(chunkedList, taskCount, [&](auto first, const auto last, const size_t task) {
+      std::optional<ResultT> &partialResult = partialResults[task];
+
+      for (; first != last; ++first) {
+        if (first->empty()) continue;
+
+        const std::span<const T> elements = first->elements();
+        const T *element = elements.data(), *end = element + elements.size();
+
+        if (!partialResult)
+          partialResult.emplace(*element++);
+
+        for (; element != end; ++element)
+          partialResult = operation(std::move(*partialResult), *element);
+      }
+    }, executor);
+
+    for (std::optional<ResultT> &partialResult: partialResults) {
+      if (partialResult)
+        init = operation(std::move(init), std::move(*partialResult));
+    }
+
+    return init;
+  }
+
+  template<typename T, size_t ChunkSize, typename Predicate, executor Executor>
+  size_t count_if(const ChunkedList<T, ChunkSize> &chunkedList, Predicate predicate, Executor &executor) {
+    const size_t taskCount = chunk_task_count(chunkedList, executor);
+
+    std::vector<size_t> counts(taskCount);
+
+    run_chunk_tasks(chunkedList, taskCount, [&](auto first, const auto last, const size_t task) {
+      size_t count = 0;
+
+      for (; first != last; ++first) {
+        if (first->empty()) continue;
+
+        const std::span<const T> elements = first->elements();
+        count += std::count_if(elements.begin(), elements.end(), std::ref(predicate));
+      }
+
+      counts[task] = count;
+    }, executor);
+
+    size_t count = 0;
+
+    for (const size_t taskCountResult: counts)
+      count += taskCountResult;
+
+    return count;
+  }
+
+  template<typename Compare, typename T, size_t ChunkSize, executor Executor>
+  void sort(ChunkedList<T, ChunkSize> &chunkedList, Executor &executor) {
+    if (1 >= chunkedList.size()) return;
+
+    using Iterator = typename ChunkedList<T, ChunkSize>::Iterator;
+
+    const size_t taskCount = chunk_task_count(chunkedList, executor);
+
+    // the runs start at each task's first Chunk, and are followed by the end of the last run
+    std::vector<Iterator> runs(taskCount + 1);
+
+    run_chunk_tasks(chunkedList, taskCount, [&](auto first, const auto last, const size_t task) {
+      Compare compare;
+
+      std::vector<Iterator> chunkRuns{};
+
+      for (auto chunkIt = first; chunkIt != last; ++chunkIt) {
+        if (chunkIt->empty()) continue;
+
+        const std::span<T> elements = chunkIt->elements();
+        std::stable_sort(elements.begin(), elements.end(), compare);
+
+        chunkRuns.emplace_back(chunkIt, chunkIt->startIndex);
+      }
+
+      runs[task] = Iterator{first, first->startIndex};
+      chunkRuns.push_back(last == chunkedList.endChunk() ? chunkedList.end() : Iterator{last, 0});
+
+      std::vector<T> buffer{};
+      sort_functions::merge_run_list<Compare>(chunkRuns, buffer);
+    }, executor);
+
+    // the end is only taken once the Chunks have been copied, if they were shared, so that it is on the back one
+    runs.back() = chunkedList.end();
+
+    while (runs.size() > 2) {
+      const size_t mergeCount = (runs.size() - 1) / 2;
+
+      executor.run(mergeCount, [&runs](const size_t merge) {
+        std::vector<T> buffer{};
+        sort_functions::merge_runs<Compare>(runs[2 * merge], runs[2 * merge + 1], runs[2 * merge + 2], buffer);
+      });
+
+      std::vector<Iterator> mergedRuns{};
+
+      for (size_t run = 0; run < runs.size() - 1; run += 2)
+        mergedRuns.push_back(runs[run]);
+
+      mergedRuns.push_back(runs.back());
+      runs = std::move(mergedRuns);
+    }
+  }
+}
@@ -0,0 +1,437 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+
+#include "ChunkedListSimd.hpp"
+
+namespace chunked_list_utility::simd {
+  inline InstructionSet supported_instruction_set() {
+#if CHUNKED_LIST_SIMD_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+      return AVX2;
+
+    return __builtin_cpu_supports("sse2") ? SSE2 : Scalar;
+#elif CHUNKED_LIST_SIMD_VECTORS
+    return SSE2;
+#else
+    return Scalar;
+#endif
+  }
+
+  inline std::atomic<InstructionSet> currentInstructionSet{supported_instruction_set()};
+
+  inline InstructionSet instruction_set() {
+    return currentInstructionSet.load(std::memory_order_relaxed);
+  }
+
+  inline void set_instruction_set(const InstructionSet instructionSet) {
+    currentInstructionSet.store(std::min(instructionSet, supported_instruction_set()), std::memory_order_relaxed);
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------
+  // Kernel implementations
+  // -------------------------------------------------------------------------------------------------------------------
+
+  namespace kernels {
+#if CHUNKED_LIST_SIMD_VECTORS
+    template<typename T, size_t Bytes>
+    struct vector_of {
+      /**
+       * @brief A vector of Bytes bytes of T, which may be loaded from any address an element can be stored at
+       */
+      typedef T type __attribute__((vector_size(Bytes), aligned(alignof(T)), may_alias));
+    };
+
+    template<typename T, size_t Bytes>
+    using vector_t = typename vector_of<T, Bytes>::type;
+
+    template<typename VectorT, typename T>
+    CHUNKED_LIST_SIMD_INLINE inline const VectorT &load(const T *data) {
+      return *reinterpret_cast<const VectorT *>(data);
+    }
+
+    template<typename MaskT>
+    CHUNKED_LIST_SIMD_INLINE inline bool any(const MaskT &mask) {
+      const auto words = std::bit_cast<std::array<uint64_t, sizeof(MaskT) / sizeof(uint64_t)> >(mask);
+
+      uint64_t combined = 0;
+
+      for (const uint64_t word: words)
+        combined |= word;
+
+      return combined != 0;
+    }
+#endif
+
+    template<size_t Bytes, typename T>
+    inline size_t find(const T *data, const size_t count, const T value) {
+      size_t index = 0;
+
+#if CHUNKED_LIST_SIMD_VECTORS
+      if constexpr (Bytes != 0) {
+        using VectorT = vector_t<T, Bytes>;
+        constexpr size_t lanes = Bytes / sizeof(T);
+
+        const VectorT values = VectorT{} + value;
+
+        // the vector holding the first match is searched again one element at a time below
+        for (; index + lanes <= count; index += lanes) {
+          if (any(load<VectorT>(data + index) == values))
+            break;
+        }
+      }
+#endif
+
+      for (; index < count; ++index) {
+        if (data[index] == value)
+          return index;
+      }
+
+      return count;
+    }
+
+    template<size_t Bytes, typename T>
+    inline size_t count(const T *data, const size_t count, const T value) {
+      size_t matches = 0, index = 0;
+
+#if CHUNKED_LIST_SIMD_VECTORS
+      if constexpr (Bytes != 0) {
+        using VectorT = vector_t<T, Bytes>;
+        using MaskT = decltype(VectorT{} == VectorT{});
+        using LaneT = std::remove_cvref_t<decltype(MaskT{}[0])>;
+        constexpr size_t lanes = Bytes / sizeof(T);
+
+        // each matching lane adds -1, so the lanes are emptied into the total before they can overflow
+        constexpr size_t blockLength = std::min<size_t>(std::numeric_limits<LaneT>::max(), 1 << 16) * lanes;
+
+        const VectorT values = VectorT{} + value;
+
+        while (index + lanes <= count) {
+          const size_t blockEnd = index + std::min(blockLength, (count - index) / lanes * lanes);
+
+          MaskT laneMatches{};
+
+          for (; index < blockEnd; index += lanes)
+            laneMatches += load<VectorT>(data + index) == values;
+
+          for (size_t lane = 0; lane < lanes; ++lane)
+            matches += static_cast<size_t>(-static_cast<int64_t>(laneMatches[lane]));
+        }
+      }
+#endif
+
+      for (; index < count; ++index)
+        matches += data[index] == value;
+
+      return matches;
+    }
+
+    template<size_t Bytes, typename T>
+    inline void minmax(const T *data, const size_t count, T &min, T &max) {
+      size_t index = 0;
+
+#if CHUNKED_LIST_SIMD_VECTORS
+      if constexpr (Bytes != 0) {
+        using VectorT = vector_t<T, Bytes>;
+        constexpr size_t lanes = Bytes / sizeof(T);
+
+        if (count >= lanes) {
+          VectorT minimums = load<VectorT>(data), maximums = minimums;
+
+          for (index = lanes; index + lanes <= count; index += lanes) {
+            const VectorT values = load<VectorT>(data + index);
+            minimums = values < minimums ? values : minimums;
+            maximums = maximums < values ? values : maximums;
+          }
+
+          for (size_t lane = 0; lane < lanes; ++lane) {
+            if (minimums[lane] < min) min = minimums[lane];
+            if (max < maximums[lane]) max = maximums[lane];
+          }
+        }
+      }
+#endif
+
+      for (; index < count; ++index) {
+        if (data[index] < min) min = data[index];
+        if (max < data[index]) max = data[index];
+      }
+    }
+
+    template<size_t Bytes, typename T>
+    inline sum_t<T> sum(const T *data, const size_t count) {
+      sum_t<T> total{};
+      size_t index = 0;
+
+#if CHUNKED_LIST_SIMD_VECTORS
+      if constexpr (Bytes != 0) {
+        if constexpr (sizeof(T) == sizeof(sum_t<T>)) {
+          using VectorT = vector_t<T, Bytes>;
+          constexpr size_t lanes = Bytes / sizeof(T);
+
+          VectorT totals{};
+
+          for (; index + lanes <= count; index += lanes)
+            totals += load<VectorT>(data + index);
+
+          for (size_t lane = 0; lane < lanes; ++lane)
+            total += static_cast<sum_t<T> >(totals[lane]);
+        } else {
+          // narrower integers are widened to 64 bits before they are added
+          using WideT = vector_t<sum_t<T>, Bytes>;
+          constexpr size_t lanes = Bytes / sizeof(sum_t<T>);
+          using NarrowT = vector_t<T, lanes * sizeof(T)>;
+
+          WideT totals{};
+
+          for (; index + lanes <= count; index += lanes)
+            totals += __builtin_convertvector(load<NarrowT>(data + index), WideT);
+
+          for (size_t lane = 0; lane < lanes; ++lane)
+            total += totals[lane];
+        }
+      }
+#endif
+
+      for (; index < count; ++index)
+        total += static_cast<sum_t<T> >(data[index]);
+
+      return total;
+    }
+
+    template<size_t Bytes, typename T>
+    inline sum_t<T> dot(const T *lhs, const T *rhs, const size_t count) {
+      sum_t<T> total{};
+      size_t index = 0;
+
+#if CHUNKED_LIST_SIMD_VECTORS
+      if constexpr (Bytes != 0) {
+        if constexpr (sizeof(T) == sizeof(sum_t<T>)) {
+          using VectorT = vector_t<T, Bytes>;
+          constexpr size_t lanes = Bytes / sizeof(T);
+
+          VectorT totals{};
+
+          for (; index + lanes <= count; index += lanes)
+            totals += load<VectorT>(lhs + index) * load<VectorT>(rhs + index);
+
+          for (size_t lane = 0; lane < lanes; ++lane)
+            total += static_cast<sum_t<T> >(totals[lane]);
+        } else {
+          using WideT = vector_t<sum_t<T>, Bytes>;
+          constexpr size_t lanes = Bytes / sizeof(sum_t<T>);
+          using NarrowT = vector_t<T, lanes * sizeof(T)>;
+
+          WideT totals{};
+
+          for (; index + lanes <= count; index += lanes) {
+            totals += __builtin_convertvector(load<NarrowT>(lhs + index), WideT)
+                * __builtin_convertvector(load<NarrowT>(rhs + index), WideT);
+          }
+
+          for (size_t lane = 0; lane < lanes; ++lane)
+            total += totals[lane];
+        }
+      }
+#endif
+
+      for (; index < count; ++index)
+        total += static_cast<sum_t<T> >(lhs[index]) * static_cast<sum_t<T> >(rhs[index]);
+
+      return total;
+    }
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------
+  // Dispatch
+  // -------------------------------------------------------------------------------------------------------------------
+
+#if CHUNKED_LIST_SIMD_X86
+  template<typename Operation>
+  __attribute__((target("avx2"))) decltype(auto) dispatch_avx2(Operation &operation) {
+    return operation.template operator()<32>();
+  }
+#endif
+
+  template<typename Operation>
+  decltype(auto) dispatch(Operation &operation) {
+#if CHUNKED_LIST_SIMD_X86
+    if (instruction_set() == AVX2)
+      return dispatch_avx2(operation);
+#endif
+
+#if CHUNKED_LIST_SIMD_VECTORS
+    if (instruction_set() == SSE2)
+      return operation.template operator()<16>();
+#endif
+
+    return operation.template operator()<0>();
+  }
+
+  template<typename T, size_t ChunkSize, typename Function>
+  inline void for_each_array(const ChunkedList<T, ChunkSize> &chunkedList, Function &&function) {
+    for (auto chunkIt = chunkedList.beginChunk(); chunkIt != chunkedList.endChunk(); ++chunkIt) {
+      if (chunkIt->size() == ChunkSize)
+        function(&(*chunkIt)[0], ChunkSize);
+      else if (!chunkIt->empty())
+        function(&(*chunkIt)[chunkIt->startIndex], chunkIt->size());
+    }
+  }
+
+  template<segmented::chunked_range ChunkedRangeT, typename Function>
+  inline void for_each_array(const ChunkedRangeT &chunkedRange, Function &&function) {
+    for (const auto chunk: chunkedRange.chunks()) {
+      if (!chunk.empty())
+        function(chunk.data(), chunk.size());
+    }
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------
+  // ChunkedList algorithm implementations
+  // -------------------------------------------------------------------------------------------------------------------
+
+  template<typename ChunkedListT, typename T>
+  auto find_element(ChunkedListT &chunkedList, const T value) -> decltype(chunkedList.end()) {
+    // the Chunks are only read, so they are searched through const iterators, which leave Chunks shared with a
+    // Snapshot alone, and only the found element is reached through the ChunkedList's own iterators
+    const auto &constList = std::as_const(chunkedList);
+    using ConstIteratorT = decltype(constList.end());
+
+    auto operation = [&]<size_t Bytes>() CHUNKED_LIST_SIMD_INLINE {
+      for (auto chunkIt = constList.beginChunk(); chunkIt != constList.endChunk(); ++chunkIt) {
+        if (chunkIt->empty()) continue;
+
+        const size_t index = kernels::find<Bytes>(&(*chunkIt)[chunkIt->startIndex], chunkIt->size(), value);
+
+        if (index != chunkIt->size())
+          return chunkedList.begin() + (ConstIteratorT{chunkIt, chunkIt->startIndex + index} - constList.begin());
+      }
+
+      return chunkedList.end();
+    };
+
+    return dispatch(operation);
+  }
+
+  template<simd_element T, size_t ChunkSize>
+  typename ChunkedList<T, ChunkSize>::Iterator find(ChunkedList<T, ChunkSize> &chunkedList, const std::type_identity_t<T> value) {
+    return find_element(chunkedList, value);
+  }
+
+  template<simd_element T, size_t ChunkSize>
+  typename ChunkedList<T, ChunkSize>::ConstIterator find(const ChunkedList<T, ChunkSize> &chunkedList, const std::type_identity_t<T> value) {
+    return find_element(chunkedList, value);
+  }
+
+  template<simd_range ChunkedRangeT>
+  size_t count(const ChunkedRangeT &chunkedRange, const std::ranges::range_value_t<ChunkedRangeT> value) {
+    using T = std::ranges::range_value_t<ChunkedRangeT>;
+
+    auto operation = [&]<size_t Bytes>() CHUNKED_LIST_SIMD_INLINE {
+      size_t matches = 0;
+
+      for_each_array(chunkedRange, [&](const T *data, const size_t count) CHUNKED_LIST_SIMD_INLINE {
+        matches += kernels::count<Bytes>(data, count, value);
+      });
+
+      return matches;
+    };
+
+    return dispatch(operation);
+  }
+
+  template<simd_element T, size_t ChunkSize>
+  bool contains(const ChunkedList<T, ChunkSize> &chunkedList, const std::type_identity_t<T> value) {
+    return find(chunkedList, value) != chunkedList.end();
+  }
+
+  template<simd_range ChunkedRangeT>
+  std::ranges::range_value_t<ChunkedRangeT> min(const ChunkedRangeT &chunkedRange) {
+    return minmax(chunkedRange).first;
+  }
+
+  template<simd_range ChunkedRangeT>
+  std::ranges::range_value_t<ChunkedRangeT> max(const ChunkedRangeT &chunkedRange) {
+    return minmax(chunkedRange).second;
+  }
+
+  template<simd_range ChunkedRangeT>
+  std::pair<std::ranges::range_value_t<ChunkedRangeT>, std::ranges::range_value_t<ChunkedRangeT> >
+  minmax(const ChunkedRangeT &chunkedRange) {
+    using T = std::ranges::range_value_t<ChunkedRangeT>;
+
+    auto operation = [&]<size_t Bytes>() CHUNKED_LIST_SIMD_INLINE {
+      T min = *std::ranges::begin(chunkedRange), max = min;
+
+      for_each_array(chunkedRange, [&](const T *data, const size_t count) CHUNKED_LIST_SIMD_INLINE {
+        kernels::minmax<Bytes>(data, count, min, max);
+      });
+
+      return std::pair<T, T>{min, max};
+    };
+
+    return dispatch(operation);
+  }
+
+  template<simd_range ChunkedRangeT>
+  sum_t<std::ranges::range_value_t<ChunkedRangeT> > sum(const ChunkedRangeT &chunkedRange) {
+    using T = std::ranges::range_value_t<ChunkedRangeT>;
+
+    auto operation = [&]<size_t Bytes>() CHUNKED_LIST_SIMD_INLINE {
+      sum_t<T> total{};
+
+      for_each_array(chunkedRange, [&](const T *data, const size_t count) CHUNKED_LIST_SIMD_INLINE {
+        total += kernels::sum<Bytes>(data, count);
+      });
+
+      return total;
+    };
+
+    return dispatch(operation);
+  }
+
+  template<simd_element T, size_t ChunkSize>
+  sum_t<T> dot(const ChunkedList<T, ChunkSize> &lhs, const ChunkedList<T, ChunkSize> &rhs) {
+    auto operation = [&]<size_t Bytes>() CHUNKED_LIST_SIMD_INLINE {
+      sum_t<T> total{};
+
+      auto lhsChunk = lhs.beginChunk(), rhsChunk = rhs.beginChunk();
+      size_t lhsIndex = lhsChunk->startIndex, rhsIndex = rhsChunk->startIndex;
+
+      // the lists' Chunks can be filled differently, so each step covers the elements left in both current Chunks
+      while (lhsChunk != lhs.endChunk() && rhsChunk != rhs.endChunk()) {
+        if (lhsIndex == lhsChunk->nextIndex) {
+          ++lhsChunk;
+          lhsIndex = 0;
+          continue;
+        }
+
+        if (rhsIndex == rhsChunk->nextIndex) {
+          ++rhsChunk;
+          rhsIndex = 0;
+          continue;
+        }
+
+        const size_t count = std::min(lhsChunk->nextIndex - lhsIndex, rhsChunk->nextIndex - rhsIndex);
+
+        total += kernels::dot<Bytes>(&(*lhsChunk)[lhsIndex], &(*rhsChunk)[rhsIndex], count);
+
+        lhsIndex += count;
+        rhsIndex += count;
+      }
+
+      return total;
+    };
+
+    return dispatch(operation);
+  }
+}
+
+#undef CHUNKED_LIST_SIMD_VECTORS
+#undef CHUNKED_LIST_SIMD_INLINE
+#undef CHUNKED_LIST_SIMD_X86
@@ -22,11 +22,70 @@ typename chunked_list<T, ChunkSize>::const_chunk_iterator chunked_list<T, ChunkS
   return derived_chunked_list::endChunk();
 }
 
+template<typename T, size_t ChunkSize>
+void chunked_list<T, ChunkSize>::append(chunked_list &&other) {
+  derived_chunked_list::splice(std::move(other));
+}
+
+template<typename T, size_t ChunkSize>
+void chunked_list<T, ChunkSize>::splice(chunked_list &&other) {
+  derived_chunked_list::splice(std::move(other));
+}
+
+template<typename T, size_t ChunkSize>
+void chunked_list<T, ChunkSize>::swap(chunked_list &other) noexcept {
+  derived_chunked_list::swap(other);
+}
+
 template<typename T, size_t ChunkSize>
 void chunked_list<T, ChunkSize>::pop_chunk() {
   derived_chunked_list::popChunk();
 }
 
+template<typename T, size_t ChunkSize>
+void chunked_list<T, ChunkSize>::push_front(T value) {
+  derived_chunked_list::pushFront(std::move(value));
+}
+
+template<typename T, size_t ChunkSize>
+template<typename... Args>
+T &chunked_list<T, ChunkSize>::emplace_front(Args &&... args) {
+  return derived_chunked_list::emplaceFront(std::forward<Args>(args)...);
+}
+
+template<typename T, size_t ChunkSize>
+void chunked_list<T, ChunkSize>::pop_front() {
+  derived_chunked_list::popFront();
+}
+
+template<typename T, size_t ChunkSize>
+void chunked_list<T, ChunkSize>::pop_front(const size_t count) {
+  derived_chunked_list::popFront(count);
+}
+
+#ifdef CHUNKED_LIST_COUNTERS
+template<typename T, size_t ChunkSize>
+void chunked_list<T, ChunkSize>::reset_counters() {
+  derived_chunked_list::resetCounters();
+}
+#endif
+
+template<typename T, size_t ChunkSize>
+template<std::predicate<const T &> Predicate>
+size_t chunked_list<T, ChunkSize>::erase_if(Predicate predicate) {
+  return derived_chunked_list::eraseIf(std::move(predicate));
+}
+
+template<typename T, size_t ChunkSize>
+void chunked_list<T, ChunkSize>::set_retention_policy(const RetentionPolicy policy, const size_t limit) {
+  derived_chunked_list::setRetentionPolicy(policy, limit);
+}
+
+template<typename T, size_t ChunkSize>
+void chunked_list<T, ChunkSize>::shrink_to_fit() {
+  derived_chunked_list::shrinkToFit();
+}
+
 template<typename T, size_t ChunkSize>
 bool chunked_list<T, ChunkSize>::operator==(const chunked_list &other) const {
   return derived_chunked_list::operator==(other);
@@ -38,6 +97,40 @@ bool chunked_list<T, ChunkSize>::operator!=(const chunked_list &other) const {
 }
 
 template<typename T, size_t ChunkSize>
-std::ostream &operator<<(std::ostream &os, chunked_list<T, ChunkSize> &chunkedList) {
-  return operator<<(os, *reinterpret_cast<ChunkedList<T, ChunkSize> *>(&chunkedList));
+size_t chunked_list<T, ChunkSize>::formatted_size(const std::string_view delimiter) const
+  requires chunked_list_utility::formatting::to_chars_formattable<T> {
+  return derived_chunked_list::formattedSize(delimiter);
+}
+
+template<typename T, size_t ChunkSize>
+std::to_chars_result chunked_list<T, ChunkSize>::format_to(char *first, char *last,
+                                                           const std::string_view delimiter) const
+  requires chunked_list_utility::formatting::to_chars_formattable<T> {
+  return derived_chunked_list::formatTo(first, last, delimiter);
+}
+
+template<typename T, size_t ChunkSize>
+void chunked_list<T, ChunkSize>::format_to(std::string &output, const std::string_view delimiter) const
+  requires chunked_list_utility::formatting::to_chars_formattable<T> {
+  derived_chunked_list::formatTo(output, delimiter);
+}
+
+template<typename T, size_t ChunkSize>
+std::ostream &operator<<(std::ostream &os, const chunked_list<T, ChunkSize> &chunkedList) {
+  return os << *reinterpret_cast<const ChunkedList<T, ChunkSize> *>(&chunkedList);
+}
+
+#ifdef __cpp_lib_format
+template<typename T, size_t ChunkSize>
+template<typename FormatContext>
+typename FormatContext::iterator std::formatter<chunked_list<T, ChunkSize>, char>::format(
+  const chunked_list<T, ChunkSize> &chunkedList, FormatContext &ctx) const {
+  return std::formatter<ChunkedList<T, ChunkSize>, char>::format(
+    *reinterpret_cast<const ChunkedList<T, ChunkSize> *>(&chunkedList), ctx);
+}
+#endif
+
+template<typename T, size_t ChunkSize>
+void swap(chunked_list<T, ChunkSize> &lhs, chunked_list<T, ChunkSize> &rhs) noexcept {
+  lhs.swap(rhs);
 }
@@ -0,0 +1,373 @@
+#pragma once
+#include "ChunkedList.hpp"
+#include "internal/ChunkedListMacros.hpp"
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy-on-write implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::SharedChunk::~SharedChunk() {
+  if (chunk)
+    deallocateChunk(chunk, slab);
+
+  releaseSlab(slab);
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::SnapshotState::chunkCount() const {
+  return sharedChunkCount + (backChunk ? 1 : 0);
+}
+
+template<typename T, size_t ChunkSize>
+const typename ChunkedList<T, ChunkSize>::Chunk *ChunkedList<T, ChunkSize>::SnapshotState::chunk(
+  const size_t index) const {
+  return index < sharedChunkCount ? sharedChunks[index] : backChunk->chunk;
+}
+
+template<typename T, size_t ChunkSize>
+bool ChunkedList<T, ChunkSize>::SnapshotState::alive() const {
+  return snapshotCount.load(std::memory_order_acquire) != 0;
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::pruneSnapshots() {
+  std::erase_if(snapshotStates, [](const std::shared_ptr<SnapshotState> &state) { return !state->alive(); });
+
+  if (snapshotStates.empty()) {
+    sharingChunks = false;
+    chunkDirectory.releaseShared();
+  }
+}
+
+template<typename T, size_t ChunkSize>
+bool ChunkedList<T, ChunkSize>::isShared(const Chunk *chunk) const {
+  // a Chunk is shared with every Snapshot taken since it was stamped, and the newest Snapshot is the last state
+  for (auto state = snapshotStates.rbegin(); state != snapshotStates.rend(); ++state) {
+    if ((*state)->alive())
+      return chunk->epoch <= (*state)->epoch;
+  }
+
+  return false;
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Chunk *ChunkedList<T, ChunkSize>::copyChunk(const Chunk *chunk) {
+  Chunk *copy = allocateChunk();
+  copy->startIndex = copy->nextIndex = chunk->startIndex;
+
+  try {
+    copy->append(chunk->elements().begin(), chunk->size());
+  } catch (...) {
+    deallocateChunk(copy);
+    throw;
+  }
+
+  return copy;
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Chunk *ChunkedList<T, ChunkSize>::writableChunk(Chunk *chunk) {
+  if (!sharingChunks)
+    return chunk;
+
+  pruneSnapshots();
+  return unshareChunk(chunk);
+}
+
+template<typename T, size_t ChunkSize>
+inline typename ChunkedList<T, ChunkSize>::Chunk *ChunkedList<T, ChunkSize>::writableIteratorChunk(Chunk *chunk) {
+  // a Chunk stamped with the current epoch was allocated or copied since the last Snapshot, so no Snapshot shares it
+  return sharingChunks && chunk->epoch != snapshotEpoch ? unshareChunk(chunk) : chunk;
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Chunk *ChunkedList<T, ChunkSize>::unshareChunk(Chunk *chunk) {
+  if constexpr (std::is_copy_constructible_v<T>) {
+    // an Iterator can be left on a Chunk which another Iterator has replaced, which the Snapshots now own
+    chunk = std::as_const(chunkDirectory).entry(chunk);
+
+    if (!isShared(chunk)) {
+      // restamping the Chunk lets Iterators skip it until the next Snapshot is taken
+      chunk->epoch = snapshotEpoch;
+      return chunk;
+    }
+
+    // everything which can throw comes before the Chunk is replaced, which leaves the ChunkedList as it was
+    Chunk *&entry = chunkDirectory.entry(chunk);
+    Chunk *copy = copyChunk(chunk);
+
+    try {
+      retireShared(chunk);
+    } catch (...) {
+      deallocateChunk(copy);
+      throw;
+    }
+
+    copy->position = chunk->position;
+    copy->prevChunk = chunk->prevChunk;
+    copy->nextChunk = chunk->nextChunk;
+
+    if (copy->prevChunk)
+      copy->prevChunk->nextChunk = copy;
+    else
+      frontChunk = copy;
+
+    if (copy->nextChunk)
+      copy->nextChunk->prevChunk = copy;
+    else
+      backChunk = copy;
+
+    entry = copy;
+    return copy;
+  } else {
+    return chunk;
+  }
+}
+
+template<typename T, size_t ChunkSize>
+void ChunkedList<T, ChunkSize>::unshareChunks() {
+  if (!sharingChunks)
+    return;
+
+  pruneSnapshots();
+
+  for (Chunk *chunk = frontChunk; chunk; chunk = chunk->nextChunk)
+    chunk = unshareChunk(chunk);
+
+  sharingChunks = false;
+}
+
+template<typename T, size_t ChunkSize>
+bool ChunkedList<T, ChunkSize>::retireShared(Chunk *chunk) {
+  const auto sharing = [chunk](const std::shared_ptr<SnapshotState> &state) {
+    return chunk->epoch <= state->epoch && state->alive();
+  };
+
+  std::shared_ptr<SharedChunk> sharedChunk{};
+
+  for (const std::shared_ptr<SnapshotState> &state: snapshotStates) {
+    if (!sharing(state))
+      continue;
+
+    if (!sharedChunk)
+      sharedChunk = std::make_shared<SharedChunk>();
+
+    state->releasedChunks.reserve(state->releasedChunks.size() + 1);
+  }
+
+  if (!sharedChunk)
+    return false;
+
+  // nothing throws from here on, so the Chunk is either handed over to every sharing Snapshot or to none
+  sharedChunk->chunk = chunk;
+  sharedChunk->slab = retainSlab(chunkSlab);
+
+  for (const std::shared_ptr<SnapshotState> &state: snapshotStates) {
+    // a Snapshot can be destroyed in the meantime, but one which wasn't sharing the Chunk can't start to
+    if (sharing(state))
+      state->releasedChunks.push_back(sharedChunk);
+  }
+
+  return true;
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Snapshot ChunkedList<T, ChunkSize>::snapshot()
+  requires std::is_copy_constructible_v<T> {
+  pruneSnapshots();
+
+  auto state = std::make_shared<SnapshotState>();
+  state->epoch = snapshotEpoch;
+  state->elementCount = elementCount;
+  state->dense = chunkDirectory.dense;
+
+  // a full back Chunk is shared like the rest, while a partially filled one is copied, as it is appended to in place
+  const bool shareBack = elementCount != 0 && backChunk->nextIndex == ChunkSize;
+
+  if (elementCount != 0) {
+    if (!shareBack && !backChunk->empty()) {
+      state->backChunk = std::make_shared<SharedChunk>();
+      state->backChunk->chunk = copyChunk(backChunk);
+      state->backChunk->slab = retainSlab(chunkSlab);
+    }
+
+    snapshotStates.reserve(snapshotStates.size() + 1);
+
+    state->sharedChunkCount = shareBack ? chunkCount : chunkCount - 1;
+
+    if (!state->dense) {
+      state->chunkEnds.reserve(chunkCount);
+
+      for (const Chunk *chunk = frontChunk; chunk; chunk = chunk->nextChunk)
+        state->chunkEnds.push_back((state->chunkEnds.empty() ? 0 : state->chunkEnds.back()) + chunk->nextIndex);
+    }
+
+    std::tie(state->directory, state->sharedChunks) = chunkDirectory.share(state->sharedChunkCount);
+    snapshotStates.push_back(state);
+    sharingChunks = sharingChunks || state->sharedChunkCount != 0;
+  }
+
+  ++snapshotEpoch;
+
+  // Chunks stamped from now on, the back one included unless it is shared, are the ChunkedList's own
+  if (!shareBack && backChunk)
+    backChunk->epoch = snapshotEpoch;
+
+  return Snapshot{std::move(state)};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Snapshot implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<typename T, size_t ChunkSize>
+std::span<const T> ChunkedList<T, ChunkSize>::Snapshot::ChunkSpan::operator()(const size_t chunk) const {
+  return state->chunk(chunk)->elements();
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::Snapshot::Snapshot(std::shared_ptr<SnapshotState> state) : state{std::move(state)} {
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::Snapshot::Snapshot(const Snapshot &other) : state{other.state} {
+  if (state)
+    state->snapshotCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::Snapshot::Snapshot(Snapshot &&other) noexcept : state{std::move(other.state)} {
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Snapshot &ChunkedList<T, ChunkSize>::Snapshot::operator=(const Snapshot &other) {
+  if (this != &other) {
+    Snapshot copy{other};
+    std::swap(state, copy.state);
+  }
+
+  return *this;
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Snapshot &ChunkedList<T, ChunkSize>::Snapshot::operator=(
+  Snapshot &&other) noexcept {
+  std::swap(state, other.state);
+  return *this;
+}
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::Snapshot::~Snapshot() {
+  // the reads of this Snapshot happen before the ChunkedList, once it sees the count drop, modifies the Chunks
+  if (state)
+    state->snapshotCount.fetch_sub(1, std::memory_order_release);
+}
+
+template<typename T, size_t ChunkSize>
+const T &ChunkedList<T, ChunkSize>::Snapshot::operator[](size_t index) const {
+  index += state->chunk(0)->startIndex;
+
+  if (state->dense)
+    return (*state->chunk(index / ChunkSize))[index % ChunkSize];
+
+  const std::vector<size_t> &ends = state->chunkEnds;
+  const auto chunk = static_cast<size_t>(std::ranges::upper_bound(ends, index) - ends.begin());
+  return (*state->chunk(chunk))[chunk == 0 ? index : index - ends[chunk - 1]];
+}
+
+template<typename T, size_t ChunkSize>
+const T &ChunkedList<T, ChunkSize>::Snapshot::front() const {
+  const Chunk *chunk = state->chunk(0);
+  return (*chunk)[chunk->startIndex];
+}
+
+template<typename T, size_t ChunkSize>
+const T &ChunkedList<T, ChunkSize>::Snapshot::back() const {
+  const Chunk *chunk = state->chunk(state->chunkCount() - 1);
+  return (*chunk)[chunk->nextIndex - 1];
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Snapshot::ConstIterator ChunkedList<T, ChunkSize>::Snapshot::begin() const {
+  if (empty())
+    return end();
+
+  return ConstIterator{state.get(), 0, state->chunk(0)->startIndex};
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Snapshot::ConstIterator ChunkedList<T, ChunkSize>::Snapshot::end() const {
+  if (empty())
+    return ConstIterator{state.get(), 0, 0};
+
+  const size_t lastChunk = state->chunkCount() - 1;
+  return ConstIterator{state.get(), lastChunk, state->chunk(lastChunk)->nextIndex};
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Snapshot::ConstChunkSpanRange ChunkedList<T, ChunkSize>::Snapshot::chunks() const {
+  const size_t chunkCount = state ? state->chunkCount() : 0;
+  return ConstChunkSpanRange{std::views::iota(size_t{0}, chunkCount), ChunkSpan{state.get()}};
+}
+
+template<typename T, size_t ChunkSize>
+size_t ChunkedList<T, ChunkSize>::Snapshot::size() const {
+  return state ? state->elementCount : 0;
+}
+
+template<typename T, size_t ChunkSize>
+bool ChunkedList<T, ChunkSize>::Snapshot::empty() const {
+  return size() == 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Snapshot::ConstIterator implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<typename T, size_t ChunkSize>
+ChunkedList<T, ChunkSize>::Snapshot::ConstIterator::ConstIterator(const SnapshotState *state, const size_t chunk,
+                                                                  const size_t index)
+  : state{state}, chunk{chunk}, index{index} {
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Snapshot::ConstIterator &
+ChunkedList<T, ChunkSize>::Snapshot::ConstIterator::operator++() {
+  ++index;
+
+  if (index == state->chunk(chunk)->nextIndex && chunk + 1 < state->chunkCount()) {
+    ++chunk;
+    index = state->chunk(chunk)->startIndex;
+  }
+
+  return *this;
+}
+
+template<typename T, size_t ChunkSize>
+typename ChunkedList<T, ChunkSize>::Snapshot::ConstIterator
+ChunkedList<T, ChunkSize>::Snapshot::ConstIterator::operator++(int) {
+  ConstIterator copy{*this};
+  ++*this;
+  return copy;
+}
+
+template<typename T, size_t ChunkSize>
+const T &ChunkedList<T, ChunkSize>::Snapshot::ConstIterator::operator*() const {
+  return (*state->chunk(chunk))[index];
+}
+
+template<typename T, size_t ChunkSize>
+const T *ChunkedList<T, ChunkSize>::Snapshot::ConstIterator::operator->() const {
+  return &**this;
+}
+
+template<typename T, size_t ChunkSize>
+bool ChunkedList<T, ChunkSize>::Snapshot::ConstIterator::operator==(const ConstIterator &other) const {
+  return state == other.state && chunk == other.chunk && index == other.index;
+}
+
+#undef DEBUG_LOG
+#undef DEBUG_LINE
+#undef DEBUG_EXECUTE
+#undef COUNTER_ADD
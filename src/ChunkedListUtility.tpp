@@ -1,7 +1,11 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
 #include <queue>
+#include <vector>
 
 #include "internal/ChunkedListUtility.hpp"
 
@@ -17,6 +21,14 @@ void chunked_list_utility::sort(ChunkedList<T, ChunkSize> &chunkedList) {
     case InsertionSort: return insertion_sort<Compare>(chunkedList);
     case QuickSort: return quick_sort<Compare, T, ChunkSize>(chunkedList.begin(), chunkedList.end());
     case HeapSort: return heap_sort<Compare>(chunkedList);
+    case MergeSort: return merge_sort<Compare>(chunkedList);
+    case IntroSort:
+      return intro_sort<Compare, T, ChunkSize>(chunkedList.begin(), chunkedList.end(),
+                                               2 * std::bit_width(chunkedList.size()));
+    case RadixSort:
+      if constexpr (radix_sortable<Compare, T>) return radix_sort<Compare>(chunkedList);
+      else static_assert(Sort != RadixSort, "RadixSort needs integral or floating-point elements compared with std::less "
+                                            "or std::greater, or a key_compare projecting elements to such keys");
   }
 }
 
@@ -146,3 +158,365 @@ void sort_functions::heap_sort(ChunkedList<T, ChunkSize> &chunkedList) {
     if (iterator == chunkedList.begin()) break;
   }
 }
+
+template<typename Compare, typename Iterator, typename T>
+void sort_functions::merge_runs(Iterator first, Iterator middle, Iterator last, std::vector<T> &buffer) {
+  Compare compare;
+
+  // the left run is moved out, so the merged elements can be written over it without overtaking the right run
+  buffer.assign(std::make_move_iterator(first), std::make_move_iterator(middle));
+
+  auto left = buffer.begin();
+  Iterator right = middle, output = first;
+
+  while (left != buffer.end() && right != last) {
+    if (compare(*right, *left)) {
+      *output = std::move(*right);
+      ++right;
+    } else {
+      *output = std::move(*left);
+      ++left;
+    }
+
+    ++output;
+  }
+
+  std::move(left, buffer.end(), output);
+}
+
+template<typename Compare, typename Iterator, typename T>
+void sort_functions::merge_run_list(std::vector<Iterator> &runs, std::vector<T> &buffer) {
+  while (runs.size() > 2) {
+    std::vector<Iterator> mergedRuns{};
+
+    size_t run = 0;
+
+    for (; run + 2 < runs.size(); run += 2) {
+      merge_runs<Compare>(runs[run], runs[run + 1], runs[run + 2], buffer);
+      mergedRuns.push_back(runs[run]);
+    }
+
+    if (run < runs.size() - 1)
+      mergedRuns.push_back(runs[run]);
+
+    mergedRuns.push_back(runs.back());
+    runs = std::move(mergedRuns);
+  }
+}
+
+template<typename Compare, typename T, size_t ChunkSize>
+void sort_functions::merge_sort(ChunkedList<T, ChunkSize> &chunkedList) {
+  if (1 >= chunkedList.size()) return;
+
+  Compare compare;
+
+  using Iterator = typename ChunkedList<T, ChunkSize>::Iterator;
+
+  // each Chunk is contiguous, so it is sorted in place as the initial run
+  std::vector<Iterator> runs{};
+
+  for (auto chunkIt = chunkedList.beginChunk(); chunkIt != chunkedList.endChunk(); ++chunkIt) {
+    if (chunkIt->empty()) continue;
+
+    const std::span<T> elements = chunkIt->elements();
+    std::stable_sort(elements.begin(), elements.end(), compare);
+
+    runs.emplace_back(chunkIt, chunkIt->startIndex);
+  }
+
+  runs.push_back(chunkedList.end());
+
+  std::vector<T> buffer{};
+  merge_run_list<Compare>(runs, buffer);
+}
+
+template<typename Compare, typename T, size_t ChunkSize>
+void sort_functions::intro_sort(typename ChunkedList<T, ChunkSize>::Iterator start,
+                                typename ChunkedList<T, ChunkSize>::Iterator end, size_t depthLimit) {
+  constexpr std::ptrdiff_t insertionSortThreshold = 16;
+
+  Compare compare;
+
+  using Iterator = typename ChunkedList<T, ChunkSize>::Iterator;
+
+  while (end - start > insertionSortThreshold) {
+    if (depthLimit == 0) {
+      std::make_heap(start, end, compare);
+      std::sort_heap(start, end, compare);
+      return;
+    }
+
+    --depthLimit;
+
+    // move the median of three elements to the start, leaving the other two to bound the partitioning loops
+    Iterator first = std::next(start), middle = start + (end - start) / 2, last = std::prev(end);
+
+    if (compare(*first, *middle)) {
+      if (compare(*middle, *last)) std::iter_swap(start, middle);
+      else if (compare(*first, *last)) std::iter_swap(start, last);
+      else std::iter_swap(start, first);
+    } else if (compare(*first, *last)) std::iter_swap(start, first);
+    else if (compare(*middle, *last)) std::iter_swap(start, last);
+    else std::iter_swap(start, middle);
+
+    Iterator left = first, right = end;
+
+    while (true) {
+      while (compare(*left, *start)) ++left;
+
+      --right;
+      while (compare(*start, *right)) --right;
+
+      if (!(left < right)) break;
+
+      std::iter_swap(left, right);
+      ++left;
+    }
+
+    // recurse into the smaller partition, so that the stack depth stays logarithmic
+    if (left - start < end - left) {
+      intro_sort<Compare, T, ChunkSize>(start, left, depthLimit);
+      start = left;
+    } else {
+      intro_sort<Compare, T, ChunkSize>(left, end, depthLimit);
+      end = left;
+    }
+  }
+
+  if (end - start <= 1) return;
+
+  for (Iterator startingIt = std::next(start); startingIt != end; ++startingIt) {
+    T value = std::move(*startingIt);
+
+    Iterator it = startingIt;
+
+    while (it != start) {
+      Iterator prevIt = std::prev(it);
+
+      if (!compare(value, *prevIt)) break;
+
+      *it = std::move(*prevIt);
+      it = prevIt;
+    }
+
+    *it = std::move(value);
+  }
+}
+
+template<radix_key Key>
+auto sort_functions::radix_bits(const Key key) {
+  if constexpr (std::floating_point<Key>) {
+    using Bits = std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t>;
+    constexpr Bits signBit = Bits{1} << (sizeof(Bits) * 8 - 1);
+
+    // negative numbers have every bit flipped so that larger magnitudes order first, positive ones only the sign bit
+    const auto bits = std::bit_cast<Bits>(key);
+    return bits & signBit ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | signBit);
+  } else {
+    using Bits = std::make_unsigned_t<Key>;
+
+    if constexpr (std::is_signed_v<Key>)
+      return static_cast<Bits>(static_cast<Bits>(key) ^ Bits{1} << (sizeof(Bits) * 8 - 1));
+    else
+      return static_cast<Bits>(key);
+  }
+}
+
+template<typename Compare, typename T, size_t ChunkSize> requires radix_sortable<Compare, T>
+void sort_functions::radix_sort(ChunkedList<T, ChunkSize> &chunkedList) {
+  const size_t size = chunkedList.size();
+
+  if (1 >= size) return;
+
+  const auto bitsOf = [](const T &value) {
+    if constexpr (template_of<key_compare, Compare>) {
+      const auto bits = radix_bits(typename Compare::projection{}(value));
+      constexpr bool descending = template_of<std::greater, typename Compare::order>;
+      return descending ? static_cast<decltype(bits)>(~bits) : bits;
+    } else {
+      const auto bits = radix_bits(value);
+      constexpr bool descending = template_of<std::greater, Compare>;
+      return descending ? static_cast<decltype(bits)>(~bits) : bits;
+    }
+  };
+
+  using Iterator = typename ChunkedList<T, ChunkSize>::Iterator;
+  constexpr size_t passes = sizeof(decltype(bitsOf(std::declval<const T &>())));
+
+  // a single read through the Chunks counts the occurrences of each byte value for every pass
+  std::vector<std::array<size_t, 256> > counts(passes);
+
+  for (const std::span<const T> elements: std::as_const(chunkedList).chunks()) {
+    for (const T &value: elements) {
+      const auto bits = bitsOf(value);
+
+      for (size_t pass = 0; pass < passes; ++pass)
+        ++counts[pass][(bits >> pass * 8) & 0xFF];
+    }
+  }
+
+  // a pass in which every element has the same byte wouldn't move anything
+  const auto skipPass = [size](const std::array<size_t, 256> &count) {
+    return std::ranges::find(count, size) != count.end();
+  };
+
+  if (std::ranges::all_of(counts, skipPass)) return;
+
+  ChunkedList<T, ChunkSize> buffer{};
+  buffer.reserve(size);
+  buffer.append(std::make_move_iterator(chunkedList.begin()), std::make_move_iterator(chunkedList.end()));
+
+  ChunkedList<T, ChunkSize> *source = &buffer, *destination = &chunkedList;
+
+  for (size_t pass = 0; pass < passes; ++pass) {
+    const std::array<size_t, 256> &count = counts[pass];
+
+    if (skipPass(count)) continue;
+
+    std::array<Iterator, 256> buckets{};
+    Iterator bucket = destination->begin();
+
+    for (size_t byte = 0; byte < 256; ++byte) {
+      buckets[byte] = bucket;
+      bucket += static_cast<std::ptrdiff_t>(count[byte]);
+    }
+
+    for (auto chunkIt = source->beginChunk(); chunkIt != source->endChunk(); ++chunkIt) {
+      for (T &value: chunkIt->elements()) {
+        *buckets[(bitsOf(value) >> pass * 8) & 0xFF]++ = std::move(value);
+      }
+    }
+
+    std::swap(source, destination);
+  }
+
+  if (source != &chunkedList)
+    std::move(source->begin(), source->end(), chunkedList.begin());
+}
+
+inline void chunked_list_utility::prefetch(const void *address, const size_t lines) {
+#if defined(__GNUC__) || defined(__clang__)
+  for (size_t line = 0; line < lines; ++line)
+    __builtin_prefetch(static_cast<const std::byte *>(address) + line * cache_line_size, 0, 3);
+#else
+  static_cast<void>(address);
+  static_cast<void>(lines);
+#endif
+}
+
+inline uint64_t chunked_list_utility::snapshot::checksum(const void *data, const size_t size, uint64_t seed) {
+  const auto *bytes = static_cast<const unsigned char *>(data);
+
+  for (size_t index = 0; index < size; ++index) {
+    seed ^= bytes[index];
+    seed *= 0x100000001b3;
+  }
+
+  return seed;
+}
+
+template<chunked_list_utility::formatting::to_chars_formattable T>
+std::to_chars_result chunked_list_utility::formatting::format_element(char *const first, char *const last,
+                                                                     const T value, const int precision) {
+  if constexpr (std::is_floating_point_v<T>)
+    return std::to_chars(first, last, value, std::chars_format::general, precision);
+  else
+    return std::to_chars(first, last, value);
+}
+
+template<chunked_list_utility::formatting::to_chars_formattable T>
+size_t chunked_list_utility::formatting::formatted_size(const T value) {
+  if constexpr (std::is_integral_v<T>) {
+    // digits are counted without formatting, which makes sizing integers far cheaper than writing them
+    using UnsignedT = std::make_unsigned_t<T>;
+
+    size_t size = 1;
+    auto magnitude = static_cast<UnsignedT>(value);
+
+    if constexpr (std::is_signed_v<T>) {
+      if (value < 0) {
+        magnitude = UnsignedT{0} - magnitude;
+        ++size;
+      }
+    }
+
+    constexpr size_t powerCount = std::numeric_limits<UnsignedT>::digits10;
+
+    // comparing against every power of 10 has no dependency between steps, unlike repeatedly dividing by 10
+    constexpr std::array<UnsignedT, powerCount> powers = [] {
+      std::array<UnsignedT, powerCount> result{};
+      UnsignedT power = 1;
+
+      for (UnsignedT &element: result)
+        element = power *= 10;
+
+      return result;
+    }();
+
+    for (const UnsignedT power: powers)
+      size += magnitude >= power;
+
+    return size;
+  } else {
+    std::array<char, max_chars<T> > buffer;
+    return static_cast<size_t>(format_element(buffer.data(), buffer.data() + buffer.size(), value).ptr - buffer.data());
+  }
+}
+
+template<typename T, size_t ChunkSize, typename Output> requires chunked_list_utility::formatting::to_chars_formattable<T>
+void chunked_list_utility::formatting::write_buffered(const ChunkedList<T, ChunkSize> &chunkedList,
+                                                      const std::string_view prefix, const std::string_view delimiter,
+                                                      const std::string_view suffix, Output output,
+                                                      const int precision) {
+  std::array<char, 1024> buffer;
+  char *position = buffer.data();
+
+  // text which doesn't fit in the buffer's remaining space is output once the buffer has been flushed
+  const auto writeText = [&](const std::string_view text) {
+    if (static_cast<size_t>(buffer.data() + buffer.size() - position) < text.size()) {
+      output(std::string_view{buffer.data(), static_cast<size_t>(position - buffer.data())});
+      position = buffer.data();
+
+      if (text.size() > buffer.size()) {
+        output(text);
+        return;
+      }
+    }
+
+    position = std::copy(text.begin(), text.end(), position);
+  };
+
+  writeText(prefix);
+  bool firstElement = true;
+
+  for (const std::span<const T> elements: chunkedList.chunks()) {
+    for (const T element: elements) {
+      if (!firstElement)
+        writeText(delimiter);
+
+      firstElement = false;
+
+      if (static_cast<size_t>(buffer.data() + buffer.size() - position) < max_chars<T>) {
+        output(std::string_view{buffer.data(), static_cast<size_t>(position - buffer.data())});
+        position = buffer.data();
+      }
+
+      position = format_element(position, buffer.data() + buffer.size(), element, precision).ptr;
+    }
+  }
+
+  writeText(suffix);
+  output(std::string_view{buffer.data(), static_cast<size_t>(position - buffer.data())});
+}
+
+template<chunked_list_utility::formatting::to_chars_formattable T>
+bool chunked_list_utility::formatting::formats_as_to_chars(const std::ios_base &stream) {
+  if (stream.flags() != (std::ios_base::skipws | std::ios_base::dec) || stream.width() != 0
+      || stream.getloc() != std::locale::classic())
+    return false;
+
+  // the general form with a precision of P takes at most P digits, a sign, a point and an exponent, within max_chars
+  return std::is_integral_v<T>
+         || (stream.precision() >= 0 && stream.precision() <= std::numeric_limits<T>::max_digits10);
+}
+
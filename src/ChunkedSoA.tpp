@@ -0,0 +1,509 @@
+#pragma once
+
+#include <memory>
+#include <new>
+
+#include "ChunkedSoA.hpp"
+
+// ---------------------------------------------------------------------------------------------------------------------
+// FieldArray and Chunk implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<size_t ChunkSize, typename... Fields>
+template<typename Field>
+Field *ChunkedSoA<ChunkSize, Fields...>::FieldArray<Field>::slot(const size_t index) {
+  return reinterpret_cast<Field *>(data + index * sizeof(Field));
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename Field>
+Field &ChunkedSoA<ChunkSize, Fields...>::FieldArray<Field>::operator[](const size_t index) {
+  return *std::launder(reinterpret_cast<Field *>(data + index * sizeof(Field)));
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename Field>
+const Field &ChunkedSoA<ChunkSize, Fields...>::FieldArray<Field>::operator[](const size_t index) const {
+  return *std::launder(reinterpret_cast<const Field *>(data + index * sizeof(Field)));
+}
+
+template<size_t ChunkSize, typename... Fields>
+ChunkedSoA<ChunkSize, Fields...>::Chunk::~Chunk() {
+  clear();
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index>
+typename ChunkedSoA<ChunkSize, Fields...>::template FieldArray<typename ChunkedSoA<ChunkSize, Fields...>::template
+  FieldType<Index> > &ChunkedSoA<ChunkSize, Fields...>::Chunk::array() {
+  return std::get<Index>(arrays);
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index>
+const typename ChunkedSoA<ChunkSize, Fields...>::template FieldArray<typename ChunkedSoA<ChunkSize, Fields...>::template
+  FieldType<Index> > &ChunkedSoA<ChunkSize, Fields...>::Chunk::array() const {
+  return std::get<Index>(arrays);
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename... Args>
+void ChunkedSoA<ChunkSize, Fields...>::Chunk::emplace(Args &&... args) {
+  [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+    size_t constructed = 0;
+
+    try {
+      ((std::construct_at(array<Indices>().slot(nextIndex), std::forward<Args>(args)), ++constructed), ...);
+    } catch (...) {
+      ((Indices < constructed ? std::destroy_at(&array<Indices>()[nextIndex]) : void()), ...);
+      throw;
+    }
+  }(std::index_sequence_for<Fields...>{});
+
+  ++nextIndex;
+}
+
+template<size_t ChunkSize, typename... Fields>
+void ChunkedSoA<ChunkSize, Fields...>::Chunk::pop() {
+  --nextIndex;
+
+  [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+    (std::destroy_at(&array<Indices>()[nextIndex]), ...);
+  }(std::index_sequence_for<Fields...>{});
+}
+
+template<size_t ChunkSize, typename... Fields>
+void ChunkedSoA<ChunkSize, Fields...>::Chunk::clear() {
+  if constexpr (!(std::is_trivially_destructible_v<Fields> && ...)) {
+    while (nextIndex > 0)
+      pop();
+  }
+
+  nextIndex = 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// GenericIterator implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::GenericIterator(
+  SoAT *soa, const size_t index) : soa(soa), index(index) {
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+ReferenceT ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator*() const {
+  return Access{}(*soa, index);
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+ReferenceT ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator[](
+  const difference_type offset) const {
+  return Access{}(*soa, index + offset);
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericIterator<SoAT, ValueT, ReferenceT, Access> &
+ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator++() {
+  ++index;
+  return *this;
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericIterator<SoAT, ValueT, ReferenceT, Access>
+ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator++(int) {
+  GenericIterator original = *this;
+  ++index;
+  return original;
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericIterator<SoAT, ValueT, ReferenceT, Access> &
+ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator--() {
+  --index;
+  return *this;
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericIterator<SoAT, ValueT, ReferenceT, Access>
+ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator--(int) {
+  GenericIterator original = *this;
+  --index;
+  return original;
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericIterator<SoAT, ValueT, ReferenceT, Access> &
+ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator+=(
+  const difference_type offset) {
+  index += offset;
+  return *this;
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericIterator<SoAT, ValueT, ReferenceT, Access> &
+ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator-=(
+  const difference_type offset) {
+  index -= offset;
+  return *this;
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericIterator<SoAT, ValueT, ReferenceT, Access>
+ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator+(
+  const difference_type offset) const {
+  return GenericIterator{soa, index + offset};
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericIterator<SoAT, ValueT, ReferenceT, Access>
+ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator-(
+  const difference_type offset) const {
+  return GenericIterator{soa, index - offset};
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericIterator<SoAT, ValueT, ReferenceT, Access>::difference_type
+ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator-(
+  const GenericIterator &other) const {
+  return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+bool ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator==(
+  const GenericIterator &other) const {
+  return index == other.index;
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+std::strong_ordering ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::operator<=>(
+  const GenericIterator &other) const {
+  return index <=> other.index;
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT, typename ValueT, typename ReferenceT, typename Access>
+size_t ChunkedSoA<ChunkSize, Fields...>::GenericIterator<SoAT, ValueT, ReferenceT, Access>::getIndex() const {
+  return index;
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename SoAT>
+decltype(auto) ChunkedSoA<ChunkSize, Fields...>::RecordAccess<SoAT>::operator()(SoAT &soa, const size_t index) const {
+  return soa[index];
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index, typename SoAT>
+decltype(auto) ChunkedSoA<ChunkSize, Fields...>::FieldAccess<Index, SoAT>::operator()(
+  SoAT &soa, const size_t index) const {
+  return std::get<Index>(soa[index]);
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index, typename SoAT>
+auto ChunkedSoA<ChunkSize, Fields...>::ChunkSpan<Index, SoAT>::operator()(const size_t chunk) const {
+  using FieldT = std::conditional_t<std::is_const_v<SoAT>, const FieldType<Index>, FieldType<Index> >;
+
+  auto &array = soa->chunkDirectory[chunk]->template array<Index>();
+  const size_t count = soa->chunkDirectory[chunk]->nextIndex;
+
+  return count == 0 ? std::span<FieldT>{} : std::span<FieldT>{&array[0], count};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// GenericColumn implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index, typename SoAT>
+ChunkedSoA<ChunkSize, Fields...>::GenericColumn<Index, SoAT>::GenericColumn(SoAT *soa) : soa(soa) {
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index, typename SoAT>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericColumn<Index, SoAT>::ColumnIterator
+ChunkedSoA<ChunkSize, Fields...>::GenericColumn<Index, SoAT>::begin() const {
+  return ColumnIterator{soa, 0};
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index, typename SoAT>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericColumn<Index, SoAT>::ColumnIterator
+ChunkedSoA<ChunkSize, Fields...>::GenericColumn<Index, SoAT>::end() const {
+  return ColumnIterator{soa, soa->size()};
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index, typename SoAT>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericColumn<Index, SoAT>::FieldT &
+ChunkedSoA<ChunkSize, Fields...>::GenericColumn<Index, SoAT>::operator[](const size_t index) const {
+  return std::get<Index>((*soa)[index]);
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index, typename SoAT>
+size_t ChunkedSoA<ChunkSize, Fields...>::GenericColumn<Index, SoAT>::size() const {
+  return soa->size();
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index, typename SoAT>
+bool ChunkedSoA<ChunkSize, Fields...>::GenericColumn<Index, SoAT>::empty() const {
+  return soa->empty();
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index, typename SoAT>
+typename ChunkedSoA<ChunkSize, Fields...>::template GenericColumn<Index, SoAT>::ChunkSpanRange
+ChunkedSoA<ChunkSize, Fields...>::GenericColumn<Index, SoAT>::chunks() const {
+  return ChunkSpanRange{std::views::iota(size_t{0}, soa->chunkDirectory.size()), ChunkSpan<Index, SoAT>{soa}};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// ChunkedSoA implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<size_t ChunkSize, typename... Fields>
+std::pair<typename ChunkedSoA<ChunkSize, Fields...>::Chunk *, size_t>
+ChunkedSoA<ChunkSize, Fields...>::locate(const size_t index) const {
+  return {chunkDirectory[index / ChunkSize], index % ChunkSize};
+}
+
+template<size_t ChunkSize, typename... Fields>
+ChunkedSoA<ChunkSize, Fields...>::ChunkedSoA(const ChunkedSoA &other) {
+  chunkDirectory.reserve(other.chunkDirectory.size());
+
+  for (size_t index = 0; index < other.size(); ++index)
+    std::apply([this](const Fields &... fields) { emplace(fields...); }, other[index]);
+}
+
+template<size_t ChunkSize, typename... Fields>
+ChunkedSoA<ChunkSize, Fields...>::ChunkedSoA(ChunkedSoA &&other) noexcept
+  : chunkDirectory(std::move(other.chunkDirectory)),
+    elementCount(std::exchange(other.elementCount, 0)),
+    spareChunk(std::exchange(other.spareChunk, nullptr)) {
+  other.chunkDirectory.clear();
+}
+
+template<size_t ChunkSize, typename... Fields>
+ChunkedSoA<ChunkSize, Fields...> &ChunkedSoA<ChunkSize, Fields...>::operator=(const ChunkedSoA &other) {
+  if (this != &other) {
+    ChunkedSoA copy{other};
+    *this = std::move(copy);
+  }
+
+  return *this;
+}
+
+template<size_t ChunkSize, typename... Fields>
+ChunkedSoA<ChunkSize, Fields...> &ChunkedSoA<ChunkSize, Fields...>::operator=(ChunkedSoA &&other) noexcept {
+  if (this != &other) {
+    std::swap(chunkDirectory, other.chunkDirectory);
+    std::swap(elementCount, other.elementCount);
+    std::swap(spareChunk, other.spareChunk);
+  }
+
+  return *this;
+}
+
+template<size_t ChunkSize, typename... Fields>
+ChunkedSoA<ChunkSize, Fields...>::~ChunkedSoA() {
+  for (Chunk *chunk: chunkDirectory)
+    delete chunk;
+
+  delete spareChunk;
+}
+
+template<size_t ChunkSize, typename... Fields>
+typename ChunkedSoA<ChunkSize, Fields...>::Reference ChunkedSoA<ChunkSize, Fields...>::operator[](const size_t index) {
+  auto [chunk, chunkIndex] = locate(index);
+
+  return [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+    return Reference{chunk->template array<Indices>()[chunkIndex]...};
+  }(std::index_sequence_for<Fields...>{});
+}
+
+template<size_t ChunkSize, typename... Fields>
+typename ChunkedSoA<ChunkSize, Fields...>::ConstReference ChunkedSoA<ChunkSize, Fields...>::operator[](
+  const size_t index) const {
+  auto [chunk, chunkIndex] = locate(index);
+
+  return [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+    return ConstReference{std::as_const(*chunk).template array<Indices>()[chunkIndex]...};
+  }(std::index_sequence_for<Fields...>{});
+}
+
+template<size_t ChunkSize, typename... Fields>
+typename ChunkedSoA<ChunkSize, Fields...>::Reference ChunkedSoA<ChunkSize, Fields...>::front() {
+  return (*this)[0];
+}
+
+template<size_t ChunkSize, typename... Fields>
+typename ChunkedSoA<ChunkSize, Fields...>::ConstReference ChunkedSoA<ChunkSize, Fields...>::front() const {
+  return (*this)[0];
+}
+
+template<size_t ChunkSize, typename... Fields>
+typename ChunkedSoA<ChunkSize, Fields...>::Reference ChunkedSoA<ChunkSize, Fields...>::back() {
+  return (*this)[elementCount - 1];
+}
+
+template<size_t ChunkSize, typename... Fields>
+typename ChunkedSoA<ChunkSize, Fields...>::ConstReference ChunkedSoA<ChunkSize, Fields...>::back() const {
+  return (*this)[elementCount - 1];
+}
+
+template<size_t ChunkSize, typename... Fields>
+typename ChunkedSoA<ChunkSize, Fields...>::Iterator ChunkedSoA<ChunkSize, Fields...>::begin() {
+  return Iterator{this, 0};
+}
+
+template<size_t ChunkSize, typename... Fields>
+typename ChunkedSoA<ChunkSize, Fields...>::ConstIterator ChunkedSoA<ChunkSize, Fields...>::begin() const {
+  return ConstIterator{this, 0};
+}
+
+template<size_t ChunkSize, typename... Fields>
+typename ChunkedSoA<ChunkSize, Fields...>::Iterator ChunkedSoA<ChunkSize, Fields...>::end() {
+  return Iterator{this, elementCount};
+}
+
+template<size_t ChunkSize, typename... Fields>
+typename ChunkedSoA<ChunkSize, Fields...>::ConstIterator ChunkedSoA<ChunkSize, Fields...>::end() const {
+  return ConstIterator{this, elementCount};
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index>
+typename ChunkedSoA<ChunkSize, Fields...>::template Column<Index> ChunkedSoA<ChunkSize, Fields...>::column() {
+  return Column<Index>{this};
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index>
+typename ChunkedSoA<ChunkSize, Fields...>::template ConstColumn<Index> ChunkedSoA<ChunkSize, Fields...>::column() const {
+  return ConstColumn<Index>{this};
+}
+
+template<size_t ChunkSize, typename... Fields>
+void ChunkedSoA<ChunkSize, Fields...>::push(Fields... values) {
+  emplace(std::move(values)...);
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<typename... Args> requires (sizeof...(Args) == sizeof...(Fields)
+                                     && (std::is_constructible_v<Fields, Args &&> && ...))
+typename ChunkedSoA<ChunkSize, Fields...>::Reference ChunkedSoA<ChunkSize, Fields...>::emplace(Args &&... args) {
+  if (elementCount == chunkDirectory.size() * ChunkSize) {
+    Chunk *chunk = spareChunk ? std::exchange(spareChunk, nullptr) : new Chunk{};
+
+    try {
+      chunk->emplace(std::forward<Args>(args)...);
+      chunkDirectory.push_back(chunk);
+    } catch (...) {
+      chunk->clear();
+      spareChunk = chunk;
+      throw;
+    }
+  } else {
+    chunkDirectory.back()->emplace(std::forward<Args>(args)...);
+  }
+
+  return (*this)[elementCount++];
+}
+
+template<size_t ChunkSize, typename... Fields>
+void ChunkedSoA<ChunkSize, Fields...>::pop() {
+  if (elementCount == 0)
+    return;
+
+  Chunk *chunk = chunkDirectory.back();
+  chunk->pop();
+  --elementCount;
+
+  if (chunk->nextIndex == 0) {
+    chunkDirectory.pop_back();
+    delete std::exchange(spareChunk, chunk);
+  }
+}
+
+template<size_t ChunkSize, typename... Fields>
+void ChunkedSoA<ChunkSize, Fields...>::clear() {
+  while (!chunkDirectory.empty()) {
+    Chunk *chunk = chunkDirectory.back();
+    chunkDirectory.pop_back();
+    chunk->clear();
+    delete std::exchange(spareChunk, chunk);
+  }
+
+  elementCount = 0;
+}
+
+template<size_t ChunkSize, typename... Fields>
+void ChunkedSoA<ChunkSize, Fields...>::permute(const std::vector<size_t> &order) {
+  [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+    ([&] {
+      std::vector<FieldType<Indices> > buffer{};
+      buffer.reserve(elementCount);
+
+      for (const size_t index: order)
+        buffer.push_back(std::move(std::get<Indices>((*this)[index])));
+
+      for (size_t index = 0; index < elementCount; ++index)
+        std::get<Indices>((*this)[index]) = std::move(buffer[index]);
+    }(), ...);
+  }(std::index_sequence_for<Fields...>{});
+}
+
+template<size_t ChunkSize, typename... Fields>
+template<size_t Index, typename Compare, chunked_list_utility::SortType Sort>
+void ChunkedSoA<ChunkSize, Fields...>::sortBy() {
+  using Key = FieldType<Index>;
+  using KeyedIndex = std::pair<Key, size_t>;
+
+  struct KeyProjection {
+    const Key &operator()(const KeyedIndex &keyedIndex) const {
+      return keyedIndex.first;
+    }
+  };
+
+  ChunkedList<KeyedIndex, ChunkSize> keys{};
+
+  for (size_t index = 0; index < elementCount; ++index)
+    keys.emplace(std::get<Index>(std::as_const(*this)[index]), index);
+
+  chunked_list_utility::sort<chunked_list_utility::key_compare<KeyProjection, Compare>, Sort>(keys);
+
+  std::vector<size_t> order{};
+  order.reserve(elementCount);
+
+  for (const KeyedIndex &keyedIndex: keys)
+    order.push_back(keyedIndex.second);
+
+  permute(order);
+}
+
+template<size_t ChunkSize, typename... Fields>
+size_t ChunkedSoA<ChunkSize, Fields...>::size() const {
+  return elementCount;
+}
+
+template<size_t ChunkSize, typename... Fields>
+bool ChunkedSoA<ChunkSize, Fields...>::empty() const {
+  return elementCount == 0;
+}
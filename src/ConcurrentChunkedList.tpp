@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "ConcurrentChunkedList.hpp"
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Chunk implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<typename T, size_t ChunkSize>
+ConcurrentChunkedList<T, ChunkSize>::Chunk::~Chunk() {
+  const size_t count = std::min(reserved.load(std::memory_order_acquire), ChunkSize);
+
+  for (size_t index = 0; index < count; ++index) {
+    if (states[index].load(std::memory_order_acquire) == Published)
+      std::destroy_at(std::launder(slot(index)));
+  }
+}
+
+template<typename T, size_t ChunkSize>
+T *ConcurrentChunkedList<T, ChunkSize>::Chunk::slot(const size_t index) {
+  return reinterpret_cast<T *>(data + index * sizeof(T));
+}
+
+template<typename T, size_t ChunkSize>
+const T &ConcurrentChunkedList<T, ChunkSize>::Chunk::operator[](const size_t index) const {
+  return *std::launder(reinterpret_cast<const T *>(data + index * sizeof(T)));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// ConstIterator implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<typename T, size_t ChunkSize>
+ConcurrentChunkedList<T, ChunkSize>::ConstIterator::ConstIterator(const Chunk *chunkPtr, const size_t index)
+  : chunk(chunkPtr), index(index) {
+  skipUnreadable();
+}
+
+template<typename T, size_t ChunkSize>
+void ConcurrentChunkedList<T, ChunkSize>::ConstIterator::skipUnreadable() {
+  while (chunk) {
+    if (index == ChunkSize) {
+      const Chunk *next = chunk->nextChunk.load(std::memory_order_acquire);
+
+      if (!next)
+        return;
+
+      chunk = next;
+      index = 0;
+    } else if (chunk->states[index].load(std::memory_order_acquire) == Abandoned) {
+      ++index;
+    } else {
+      return;
+    }
+  }
+}
+
+template<typename T, size_t ChunkSize>
+typename ConcurrentChunkedList<T, ChunkSize>::ConstIterator &
+ConcurrentChunkedList<T, ChunkSize>::ConstIterator::operator++() {
+  ++index;
+  skipUnreadable();
+  return *this;
+}
+
+template<typename T, size_t ChunkSize>
+typename ConcurrentChunkedList<T, ChunkSize>::ConstIterator
+ConcurrentChunkedList<T, ChunkSize>::ConstIterator::operator++(int) {
+  ConstIterator original = *this;
+  ++*this;
+  return original;
+}
+
+template<typename T, size_t ChunkSize>
+const T &ConcurrentChunkedList<T, ChunkSize>::ConstIterator::operator*() const {
+  return (*chunk)[index];
+}
+
+template<typename T, size_t ChunkSize>
+const T *ConcurrentChunkedList<T, ChunkSize>::ConstIterator::operator->() const {
+  return &(*chunk)[index];
+}
+
+template<typename T, size_t ChunkSize>
+bool ConcurrentChunkedList<T, ChunkSize>::ConstIterator::operator==(const ConstIterator &other) const {
+  return chunk == other.chunk && index == other.index;
+}
+
+template<typename T, size_t ChunkSize>
+bool ConcurrentChunkedList<T, ChunkSize>::ConstIterator::operator==(Sentinel) const {
+  return !chunk || index == ChunkSize || chunk->states[index].load(std::memory_order_acquire) != Published;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// ConcurrentChunkedList implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<typename T, size_t ChunkSize>
+ConcurrentChunkedList<T, ChunkSize>::ConcurrentChunkedList() : front(new Chunk{}), back(front) {
+}
+
+template<typename T, size_t ChunkSize>
+ConcurrentChunkedList<T, ChunkSize>::~ConcurrentChunkedList() {
+  Chunk *chunk = front;
+
+  while (chunk) {
+    Chunk *next = chunk->nextChunk.load(std::memory_order_acquire);
+    delete chunk;
+    chunk = next;
+  }
+}
+
+template<typename T, size_t ChunkSize>
+typename ConcurrentChunkedList<T, ChunkSize>::Chunk *ConcurrentChunkedList<T, ChunkSize>::advanceChunk(Chunk *chunk) {
+  Chunk *next = chunk->nextChunk.load(std::memory_order_acquire);
+
+  if (!next) {
+    // every producer which overflowed the Chunk races to link a new one, and those which lose free theirs
+    Chunk *newChunk = new Chunk{};
+
+    if (chunk->nextChunk.compare_exchange_strong(next, newChunk, std::memory_order_acq_rel, std::memory_order_acquire))
+      next = newChunk;
+    else
+      delete newChunk;
+  }
+
+  // fails harmlessly if another producer has already moved the back Chunk forwards
+  back.compare_exchange_strong(chunk, next, std::memory_order_acq_rel, std::memory_order_relaxed);
+
+  return next;
+}
+
+template<typename T, size_t ChunkSize>
+void ConcurrentChunkedList<T, ChunkSize>::push(T value) {
+  emplace(std::move(value));
+}
+
+template<typename T, size_t ChunkSize>
+template<typename... Args>
+T &ConcurrentChunkedList<T, ChunkSize>::emplace(Args &&... args) {
+  Chunk *chunk = back.load(std::memory_order_acquire);
+  size_t index;
+
+  while ((index = chunk->reserved.fetch_add(1, std::memory_order_relaxed)) >= ChunkSize)
+    chunk = advanceChunk(chunk);
+
+  T *element;
+
+  try {
+    element = std::construct_at(chunk->slot(index), std::forward<Args>(args)...);
+  } catch (...) {
+    chunk->states[index].store(Abandoned, std::memory_order_release);
+    throw;
+  }
+
+  chunk->states[index].store(Published, std::memory_order_release);
+  elementCount.fetch_add(1, std::memory_order_relaxed);
+
+  return *element;
+}
+
+template<typename T, size_t ChunkSize>
+typename ConcurrentChunkedList<T, ChunkSize>::ConstIterator ConcurrentChunkedList<T, ChunkSize>::begin() const {
+  return ConstIterator{front};
+}
+
+template<typename T, size_t ChunkSize>
+typename ConcurrentChunkedList<T, ChunkSize>::Sentinel ConcurrentChunkedList<T, ChunkSize>::end() const {
+  return Sentinel{};
+}
+
+template<typename T, size_t ChunkSize>
+size_t ConcurrentChunkedList<T, ChunkSize>::size() const {
+  return elementCount.load(std::memory_order_relaxed);
+}
+
+template<typename T, size_t ChunkSize>
+bool ConcurrentChunkedList<T, ChunkSize>::empty() const {
+  return size() == 0;
+}
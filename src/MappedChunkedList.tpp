@@ -0,0 +1,168 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "MappedChunkedList.hpp"
+
+template<typename T, size_t ChunkSize>
+std::span<const T> MappedChunkedList<T, ChunkSize>::ChunkSpan::operator()(const size_t chunk) const {
+  const size_t first = chunk * ChunkSize;
+  return {elements + first, std::min(ChunkSize, elementCount - first)};
+}
+
+template<typename T, size_t ChunkSize>
+MappedChunkedList<T, ChunkSize>::MappedChunkedList(const std::filesystem::path &path) {
+  namespace snapshot = chunked_list_utility::snapshot;
+
+  const int file = ::open(path.c_str(), O_RDONLY);
+
+  if (file == -1)
+    throw std::system_error{errno, std::generic_category(), "Failed to open " + path.string()};
+
+  struct stat status{};
+
+  if (::fstat(file, &status) == -1) {
+    const int error = errno;
+    ::close(file);
+    throw std::system_error{error, std::generic_category(), "Failed to read the size of " + path.string()};
+  }
+
+  mappingSize = static_cast<size_t>(status.st_size);
+
+  if (mappingSize < sizeof(snapshot::header)) {
+    ::close(file);
+    throw std::runtime_error{path.string() + " is too short to be a ChunkedList snapshot"};
+  }
+
+  mapping = ::mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, file, 0);
+  const int error = errno;
+
+  // the mapping keeps its own reference to the file
+  ::close(file);
+
+  if (mapping == MAP_FAILED) {
+    mapping = nullptr;
+    throw std::system_error{error, std::generic_category(), "Failed to map " + path.string()};
+  }
+
+  snapshot::header header{};
+  std::memcpy(&header, mapping, sizeof(header));
+
+  const char *problem = nullptr;
+
+  if (header.magic != snapshot::magic)
+    problem = " is not a ChunkedList snapshot";
+  else if (header.version != snapshot::version)
+    problem = " is from an unsupported version of the snapshot format";
+  else if (header.byteOrder != snapshot::byteOrderMark)
+    problem = " was saved with a different byte order";
+  else if (header.typeSize != sizeof(T) || header.typeAlignment != alignof(T) || header.chunkSize != ChunkSize)
+    problem = " was saved from a ChunkedList of a different type or ChunkSize";
+  else if (header.elementCount > (mappingSize - sizeof(header)) / sizeof(T))
+    problem = " is shorter than its element count";
+
+  if (problem) {
+    unmap();
+    throw std::runtime_error{path.string() + problem};
+  }
+
+  elements = reinterpret_cast<const T *>(static_cast<const std::byte *>(mapping) + sizeof(header));
+  elementCount = header.elementCount;
+  savedChecksum = header.checksum;
+}
+
+template<typename T, size_t ChunkSize>
+MappedChunkedList<T, ChunkSize>::MappedChunkedList(MappedChunkedList &&other) noexcept
+  : mapping{std::exchange(other.mapping, nullptr)},
+    mappingSize{std::exchange(other.mappingSize, 0)},
+    elements{std::exchange(other.elements, nullptr)},
+    elementCount{std::exchange(other.elementCount, 0)},
+    savedChecksum{std::exchange(other.savedChecksum, 0)} {
+}
+
+template<typename T, size_t ChunkSize>
+MappedChunkedList<T, ChunkSize> &MappedChunkedList<T, ChunkSize>::operator=(MappedChunkedList &&other) noexcept {
+  if (this != &other) {
+    unmap();
+
+    mapping = std::exchange(other.mapping, nullptr);
+    mappingSize = std::exchange(other.mappingSize, 0);
+    elements = std::exchange(other.elements, nullptr);
+    elementCount = std::exchange(other.elementCount, 0);
+    savedChecksum = std::exchange(other.savedChecksum, 0);
+  }
+
+  return *this;
+}
+
+template<typename T, size_t ChunkSize>
+MappedChunkedList<T, ChunkSize>::~MappedChunkedList() {
+  unmap();
+}
+
+template<typename T, size_t ChunkSize>
+void MappedChunkedList<T, ChunkSize>::unmap() {
+  if (mapping)
+    ::munmap(mapping, mappingSize);
+
+  mapping = nullptr;
+  mappingSize = 0;
+  elements = nullptr;
+  elementCount = 0;
+}
+
+template<typename T, size_t ChunkSize>
+const T &MappedChunkedList<T, ChunkSize>::operator[](const size_t index) const {
+  return elements[index];
+}
+
+template<typename T, size_t ChunkSize>
+const T &MappedChunkedList<T, ChunkSize>::front() const {
+  return elements[0];
+}
+
+template<typename T, size_t ChunkSize>
+const T &MappedChunkedList<T, ChunkSize>::back() const {
+  return elements[elementCount - 1];
+}
+
+template<typename T, size_t ChunkSize>
+typename MappedChunkedList<T, ChunkSize>::ConstIterator MappedChunkedList<T, ChunkSize>::begin() const {
+  return elements;
+}
+
+template<typename T, size_t ChunkSize>
+typename MappedChunkedList<T, ChunkSize>::ConstIterator MappedChunkedList<T, ChunkSize>::end() const {
+  return elements + elementCount;
+}
+
+template<typename T, size_t ChunkSize>
+typename MappedChunkedList<T, ChunkSize>::ConstChunkSpanRange MappedChunkedList<T, ChunkSize>::chunks() const {
+  const size_t chunkCount = (elementCount + ChunkSize - 1) / ChunkSize;
+  return ConstChunkSpanRange{std::ranges::iota_view<size_t, size_t>{0, chunkCount}, ChunkSpan{elements, elementCount}};
+}
+
+template<typename T, size_t ChunkSize>
+size_t MappedChunkedList<T, ChunkSize>::size() const {
+  return elementCount;
+}
+
+template<typename T, size_t ChunkSize>
+bool MappedChunkedList<T, ChunkSize>::empty() const {
+  return elementCount == 0;
+}
+
+template<typename T, size_t ChunkSize>
+bool MappedChunkedList<T, ChunkSize>::verify() const {
+  return chunked_list_utility::snapshot::checksum(elements, elementCount * sizeof(T)) == savedChecksum;
+}
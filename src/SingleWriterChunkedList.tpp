@@ -0,0 +1,355 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "SingleWriterChunkedList.hpp"
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Chunk implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<typename T, size_t ChunkSize>
+SingleWriterChunkedList<T, ChunkSize>::Chunk::~Chunk() {
+  const size_t count = constructedCount.load(std::memory_order_relaxed);
+
+  for (size_t index = 0; index < count; ++index)
+    std::destroy_at(std::launder(slot(index)));
+}
+
+template<typename T, size_t ChunkSize>
+T *SingleWriterChunkedList<T, ChunkSize>::Chunk::slot(const size_t index) {
+  return reinterpret_cast<T *>(data + index * sizeof(T));
+}
+
+template<typename T, size_t ChunkSize>
+const T &SingleWriterChunkedList<T, ChunkSize>::Chunk::operator[](const size_t index) const {
+  return *std::launder(reinterpret_cast<const T *>(data + index * sizeof(T)));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// View::ConstIterator implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<typename T, size_t ChunkSize>
+SingleWriterChunkedList<T, ChunkSize>::View::ConstIterator::ConstIterator(const Chunk *chunkPtr, const size_t remaining)
+  : chunk(chunkPtr), remaining(remaining) {
+  if (chunk && remaining != 0)
+    available = chunk->constructedCount.load(std::memory_order_acquire);
+}
+
+template<typename T, size_t ChunkSize>
+void SingleWriterChunkedList<T, ChunkSize>::View::ConstIterator::refresh() {
+  if (index != ChunkSize) {
+    available = chunk->constructedCount.load(std::memory_order_acquire);
+    return;
+  }
+
+  // sequentially consistent, so that a Chunk unlinked before the View announced its epoch is never reached
+  chunk = chunk->nextChunk.load(std::memory_order_seq_cst);
+  index = 0;
+  available = chunk ? chunk->constructedCount.load(std::memory_order_acquire) : 0;
+}
+
+template<typename T, size_t ChunkSize>
+typename SingleWriterChunkedList<T, ChunkSize>::View::ConstIterator &
+SingleWriterChunkedList<T, ChunkSize>::View::ConstIterator::operator++() {
+  ++index;
+
+  if (--remaining != 0 && index == available)
+    refresh();
+
+  return *this;
+}
+
+template<typename T, size_t ChunkSize>
+typename SingleWriterChunkedList<T, ChunkSize>::View::ConstIterator
+SingleWriterChunkedList<T, ChunkSize>::View::ConstIterator::operator++(int) {
+  ConstIterator original = *this;
+  ++*this;
+  return original;
+}
+
+template<typename T, size_t ChunkSize>
+const T &SingleWriterChunkedList<T, ChunkSize>::View::ConstIterator::operator*() const {
+  return (*chunk)[index];
+}
+
+template<typename T, size_t ChunkSize>
+const T *SingleWriterChunkedList<T, ChunkSize>::View::ConstIterator::operator->() const {
+  return &(*chunk)[index];
+}
+
+template<typename T, size_t ChunkSize>
+bool SingleWriterChunkedList<T, ChunkSize>::View::ConstIterator::operator==(const ConstIterator &other) const {
+  return chunk == other.chunk && index == other.index && remaining == other.remaining;
+}
+
+template<typename T, size_t ChunkSize>
+bool SingleWriterChunkedList<T, ChunkSize>::View::ConstIterator::operator==(Sentinel) const {
+  return remaining == 0 || index == available;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// View implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<typename T, size_t ChunkSize>
+SingleWriterChunkedList<T, ChunkSize>::View::View(ReaderRecord *record, const SingleWriterChunkedList &list)
+  : record(record),
+    elementCount(list.elementCount.load(std::memory_order_acquire)) {
+  frontChunk = list.frontChunk.load(std::memory_order_seq_cst);
+}
+
+template<typename T, size_t ChunkSize>
+SingleWriterChunkedList<T, ChunkSize>::View::View(View &&other) noexcept
+  : record(std::exchange(other.record, nullptr)),
+    frontChunk(other.frontChunk),
+    elementCount(other.elementCount) {
+}
+
+template<typename T, size_t ChunkSize>
+SingleWriterChunkedList<T, ChunkSize>::View::~View() {
+  // releases the reads of the View to the writer, which acquires them before deallocating a Chunk
+  if (record)
+    record->epoch.store(0, std::memory_order_release);
+}
+
+template<typename T, size_t ChunkSize>
+typename SingleWriterChunkedList<T, ChunkSize>::View::ConstIterator
+SingleWriterChunkedList<T, ChunkSize>::View::begin() const {
+  return ConstIterator{frontChunk, elementCount};
+}
+
+template<typename T, size_t ChunkSize>
+typename SingleWriterChunkedList<T, ChunkSize>::View::Sentinel SingleWriterChunkedList<T, ChunkSize>::View::end() const {
+  return Sentinel{};
+}
+
+template<typename T, size_t ChunkSize>
+size_t SingleWriterChunkedList<T, ChunkSize>::View::size() const {
+  return elementCount;
+}
+
+template<typename T, size_t ChunkSize>
+bool SingleWriterChunkedList<T, ChunkSize>::View::empty() const {
+  return elementCount == 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Reader implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<typename T, size_t ChunkSize>
+SingleWriterChunkedList<T, ChunkSize>::Reader::Reader(const SingleWriterChunkedList &list, ReaderRecord *record)
+  : list(&list), record(record) {
+}
+
+template<typename T, size_t ChunkSize>
+SingleWriterChunkedList<T, ChunkSize>::Reader::Reader(Reader &&other) noexcept
+  : list(other.list), record(std::exchange(other.record, nullptr)) {
+}
+
+template<typename T, size_t ChunkSize>
+SingleWriterChunkedList<T, ChunkSize>::Reader::~Reader() {
+  if (record)
+    record->claimed.store(false, std::memory_order_release);
+}
+
+template<typename T, size_t ChunkSize>
+typename SingleWriterChunkedList<T, ChunkSize>::View SingleWriterChunkedList<T, ChunkSize>::Reader::view() const {
+  // the epoch is announced before any Chunk is loaded, and both are sequentially consistent, so the writer either sees
+  // the epoch or unlinked its Chunks before they were loaded
+  record->epoch.store(list->globalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+  return View{record, *list};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// SingleWriterChunkedList implementation
+// ---------------------------------------------------------------------------------------------------------------------
+
+template<typename T, size_t ChunkSize>
+SingleWriterChunkedList<T, ChunkSize>::SingleWriterChunkedList() : frontChunk(new Chunk{}) {
+  backChunk = frontChunk.load(std::memory_order_relaxed);
+}
+
+template<typename T, size_t ChunkSize>
+SingleWriterChunkedList<T, ChunkSize>::~SingleWriterChunkedList() {
+  Chunk *chunk = frontChunk.load(std::memory_order_acquire);
+
+  while (chunk) {
+    Chunk *next = chunk->nextChunk.load(std::memory_order_relaxed);
+    delete chunk;
+    chunk = next;
+  }
+
+  for (const RetiredChunk &retired: retiredChunks)
+    delete retired.chunk;
+
+  ReaderRecord *record = readerRecords.load(std::memory_order_acquire);
+
+  while (record) {
+    ReaderRecord *next = record->nextRecord;
+    delete record;
+    record = next;
+  }
+}
+
+template<typename T, size_t ChunkSize>
+void SingleWriterChunkedList<T, ChunkSize>::pushChunk() {
+  Chunk *chunk = new Chunk{};
+  chunk->prevChunk = backChunk;
+
+  backChunk->nextChunk.store(chunk, std::memory_order_release);
+  backChunk = chunk;
+  backIndex = 0;
+}
+
+template<typename T, size_t ChunkSize>
+void SingleWriterChunkedList<T, ChunkSize>::replaceBack(const size_t count) {
+  auto copy = std::make_unique<Chunk>();
+  std::uninitialized_copy_n(&(*backChunk)[0], count, copy->slot(0));
+  copy->constructedCount.store(count, std::memory_order_relaxed);
+  copy->prevChunk = backChunk->prevChunk;
+
+  retiredChunks.reserve(retiredChunks.size() + 1);
+
+  // readers already in the original Chunk keep reading it, while those which reach the back afterwards read the copy
+  if (copy->prevChunk)
+    copy->prevChunk->nextChunk.store(copy.get(), std::memory_order_seq_cst);
+  else
+    frontChunk.store(copy.get(), std::memory_order_seq_cst);
+
+  Chunk *original = std::exchange(backChunk, copy.release());
+  retireChunk(original);
+}
+
+template<typename T, size_t ChunkSize>
+void SingleWriterChunkedList<T, ChunkSize>::retireChunk(Chunk *chunk) {
+  const size_t epoch = globalEpoch.load(std::memory_order_relaxed);
+  retiredChunks.push_back(RetiredChunk{chunk, epoch});
+
+  // Views created from now on announce a later epoch, and can't reach the Chunk
+  globalEpoch.store(epoch + 1, std::memory_order_seq_cst);
+
+  reclaimChunks();
+}
+
+template<typename T, size_t ChunkSize>
+void SingleWriterChunkedList<T, ChunkSize>::reclaimChunks() {
+  size_t oldestEpoch = std::numeric_limits<size_t>::max();
+
+  for (ReaderRecord *record = readerRecords.load(std::memory_order_seq_cst); record; record = record->nextRecord) {
+    const size_t epoch = record->epoch.load(std::memory_order_seq_cst);
+
+    if (epoch != 0)
+      oldestEpoch = std::min(oldestEpoch, epoch);
+  }
+
+  std::erase_if(retiredChunks, [oldestEpoch](const RetiredChunk &retired) {
+    if (retired.epoch >= oldestEpoch)
+      return false;
+
+    delete retired.chunk;
+    return true;
+  });
+}
+
+template<typename T, size_t ChunkSize>
+typename SingleWriterChunkedList<T, ChunkSize>::Reader SingleWriterChunkedList<T, ChunkSize>::reader() const {
+  ReaderRecord *head = readerRecords.load(std::memory_order_acquire);
+
+  for (ReaderRecord *record = head; record; record = record->nextRecord) {
+    if (!record->claimed.load(std::memory_order_relaxed) && !record->claimed.exchange(true, std::memory_order_acquire))
+      return Reader{*this, record};
+  }
+
+  auto *record = new ReaderRecord{};
+  record->nextRecord = head;
+
+  while (!readerRecords.compare_exchange_weak(record->nextRecord, record, std::memory_order_seq_cst,
+                                              std::memory_order_acquire)) {
+  }
+
+  return Reader{*this, record};
+}
+
+template<typename T, size_t ChunkSize>
+void SingleWriterChunkedList<T, ChunkSize>::push(T value) {
+  emplace(std::move(value));
+}
+
+template<typename T, size_t ChunkSize>
+template<typename... Args>
+const T &SingleWriterChunkedList<T, ChunkSize>::emplace(Args &&... args) {
+  if (backIndex == ChunkSize) {
+    pushChunk();
+  } else if (backIndex < backChunk->constructedCount.load(std::memory_order_relaxed)) {
+    // a reader may still be reading the popped element in the slot, so it is never constructed over
+    if constexpr (std::is_copy_constructible_v<T>)
+      replaceBack(backIndex);
+  }
+
+  const T *element = std::construct_at(backChunk->slot(backIndex), std::forward<Args>(args)...);
+
+  ++backIndex;
+  backChunk->constructedCount.store(backIndex, std::memory_order_release);
+  elementCount.store(elementCount.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+  return *element;
+}
+
+template<typename T, size_t ChunkSize>
+void SingleWriterChunkedList<T, ChunkSize>::pop() requires std::is_copy_constructible_v<T> {
+  const size_t count = elementCount.load(std::memory_order_relaxed);
+
+  if (count == 0)
+    return;
+
+  if (backIndex == 0)
+    popChunk();
+
+  --backIndex;
+  elementCount.store(count - 1, std::memory_order_release);
+}
+
+template<typename T, size_t ChunkSize>
+void SingleWriterChunkedList<T, ChunkSize>::popChunk() requires std::is_copy_constructible_v<T> {
+  const size_t count = elementCount.load(std::memory_order_relaxed) - backIndex;
+
+  if (!backChunk->prevChunk) {
+    backIndex = 0;
+    elementCount.store(count, std::memory_order_release);
+    return;
+  }
+
+  retiredChunks.reserve(retiredChunks.size() + 1);
+
+  Chunk *chunk = std::exchange(backChunk, backChunk->prevChunk);
+  backChunk->nextChunk.store(nullptr, std::memory_order_seq_cst);
+  backIndex = ChunkSize;
+  elementCount.store(count, std::memory_order_release);
+
+  retireChunk(chunk);
+}
+
+template<typename T, size_t ChunkSize>
+const T &SingleWriterChunkedList<T, ChunkSize>::back() const {
+  // the back Chunk is empty after popping its last element, leaving the last element in the Chunk before it
+  if (backIndex == 0)
+    return (*backChunk->prevChunk)[ChunkSize - 1];
+
+  return (*backChunk)[backIndex - 1];
+}
+
+template<typename T, size_t ChunkSize>
+size_t SingleWriterChunkedList<T, ChunkSize>::size() const {
+  return elementCount.load(std::memory_order_acquire);
+}
+
+template<typename T, size_t ChunkSize>
+bool SingleWriterChunkedList<T, ChunkSize>::empty() const {
+  return size() == 0;
+}